@@ -0,0 +1,147 @@
+//
+// Created by hwyz_leo on 2025/8/27.
+//
+
+#ifndef RSMSAPP_CAN_INGEST_H
+#define RSMSAPP_CAN_INGEST_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "yaml-cpp/yaml.h"
+
+#include "rsms_signal_cache.h"
+
+// 扩展帧标识，与SocketCAN的CAN_EFF_FLAG相同，解析计划与解析时的扩展帧CAN ID带此标识，与相同数值的标准帧区分
+const uint32_t kCanExtendedFlag = 0x80000000U;
+
+// CAN信号解析计划（启动时由配置预编译）
+struct can_signal_plan_t {
+    int key; // 信号缓存Key
+    signal_type_t type; // 信号数据类型
+    bool big_endian; // 是否Motorola字节序
+    bool is_signed; // 原始值是否有符号
+    uint8_t shift; // 按64位整形读取报文后的右移位数
+    uint8_t length; // 信号长度（位）
+    uint64_t mask; // 信号掩码
+    double factor; // 精度
+    double offset; // 偏移量
+};
+
+/**
+ * CAN报文采集
+ * 从SocketCAN接口或candump日志读取原始CAN报文，按DBC风格的信号定义（起始位、长度、精度、偏移量）
+ * 预编译的查表计划直接解析并写入国标信号缓存，无需经过MCU转换与MQTT转发
+ */
+class CanIngest {
+public:
+    /**
+     * 析构虚函数
+     */
+    ~CanIngest() = default;
+
+    /**
+     * 防止对象被复制
+     */
+    CanIngest(const CanIngest &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    CanIngest &operator=(const CanIngest &) = delete;
+
+    /**
+     * 获取单例
+     * @return 单例
+     */
+    static CanIngest &get_instance();
+
+public:
+    /**
+     * 加载配置
+     * @param config 配置信息
+     * @return 是否加载成功
+     */
+    bool load_config(const YAML::Node &config);
+
+    /**
+     * 启动
+     * @return 启动是否成功
+     */
+    bool start();
+
+    /**
+     * 停止
+     */
+    void stop();
+
+    /**
+     * 解析一帧CAN报文并写入信号缓存
+     * @param can_id CAN ID，扩展帧带kCanExtendedFlag
+     * @param data 数据
+     * @param length 数据长度
+     * @return 是否存在该CAN ID的解析计划
+     */
+    bool decode_frame(uint32_t can_id, const uint8_t *data, uint8_t length);
+
+private:
+    // 是否启用
+    bool is_enabled_ = false;
+    // 是否启动
+    std::atomic_bool is_started_{false};
+    // CAN接口名称
+    std::string interface_ = "vcan0";
+    // candump日志路径，不为空时回放日志而不读取CAN接口
+    std::string replay_file_;
+    // 回放时是否按日志时间间隔发送
+    bool replay_realtime_ = true;
+    // CAN ID（扩展帧带kCanExtendedFlag）对应的信号解析计划
+    std::unordered_map<uint32_t, std::vector<can_signal_plan_t>> frame_plans_;
+    // 采集线程
+    std::thread ingest_thread_;
+    // 已解析报文数量
+    std::atomic<uint64_t> frame_count_{0};
+
+private:
+    /**
+     * 构造函数
+     */
+    CanIngest() = default;
+
+    /**
+     * 编译信号解析计划
+     * @param signal 信号配置
+     * @param out_plan 解析计划
+     * @return 是否编译成功
+     */
+    static bool compile_signal(const YAML::Node &signal, can_signal_plan_t &out_plan);
+
+    /**
+     * 读取SocketCAN接口的线程函数
+     */
+    void socket_thread();
+
+    /**
+     * 回放candump日志的线程函数
+     */
+    void replay_thread();
+
+    /**
+     * 解析candump日志行，格式为"(1436509052.249713) vcan0 123#11223344"
+     * @param line 日志行
+     * @param out_timestamp 时间戳（秒）
+     * @param out_can_id CAN ID，扩展帧带kCanExtendedFlag
+     * @param out_data 数据
+     * @param out_length 数据长度
+     * @return 是否解析成功
+     */
+    static bool parse_candump_line(const std::string &line, double &out_timestamp, uint32_t &out_can_id,
+                                   uint8_t *out_data, uint8_t &out_length);
+};
+
+#endif //RSMSAPP_CAN_INGEST_H
@@ -0,0 +1,20 @@
+//
+// Created by hwyz_leo on 2025/8/29.
+//
+
+#ifndef RSMSAPP_CRC32_H
+#define RSMSAPP_CRC32_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * 计算CRC32校验码（IEEE 802.3多项式）
+ * @param data 数据
+ * @param length 数据长度
+ * @param crc 上一段数据的校验码，用于分段计算
+ * @return 校验码
+ */
+uint32_t calculate_crc32(const uint8_t *data, size_t length, uint32_t crc = 0);
+
+#endif //RSMSAPP_CRC32_H
@@ -0,0 +1,112 @@
+//
+// Created by hwyz_leo on 2025/8/28.
+//
+
+#ifndef RSMSAPP_IPC_INGEST_H
+#define RSMSAPP_IPC_INGEST_H
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "yaml-cpp/yaml.h"
+
+#include "mqtt_topic_router.h"
+
+// MCU数据接入方式
+enum ingest_transport_t {
+    INGEST_TRANSPORT_MQTT = 0, // 经本地MQTT服务转发
+    INGEST_TRANSPORT_IPC = 1, // 本地Unix套接字直连
+};
+
+/**
+ * 本地IPC数据接入
+ * MCU桥接进程通过SOCK_SEQPACKET类型的Unix套接字直接发送数据，不经过MQTT服务与base64编码
+ * 每个数据包为：主题长度（1字节）+ 主题 + 原始protobuf数据，按主题路由到与MQTT相同的消息处理器
+ */
+class IpcIngest {
+public:
+    /**
+     * 析构虚函数
+     */
+    ~IpcIngest() = default;
+
+    /**
+     * 防止对象被复制
+     */
+    IpcIngest(const IpcIngest &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    IpcIngest &operator=(const IpcIngest &) = delete;
+
+    /**
+     * 获取单例
+     * @return 单例
+     */
+    static IpcIngest &get_instance();
+
+public:
+    /**
+     * 加载配置
+     * @param config 配置信息
+     * @return 是否加载成功
+     */
+    bool load_config(const YAML::Node &config);
+
+    /**
+     * 启动
+     * @return 启动是否成功
+     */
+    bool start();
+
+    /**
+     * 停止
+     */
+    void stop();
+
+    /**
+     * 获取MCU数据接入方式
+     * @return MCU数据接入方式
+     */
+    ingest_transport_t get_transport() const;
+
+private:
+    // MCU数据接入方式
+    ingest_transport_t transport_ = INGEST_TRANSPORT_MQTT;
+    // 是否启动
+    std::atomic_bool is_started_{false};
+    // 套接字路径
+    std::string socket_path_ = "/tmp/rsms_ingest.sock";
+    // 主题前缀
+    std::string topic_prefix_ = "RSMS/";
+    // 消息路由
+    MqttTopicRouter topic_router_;
+    // 接收线程
+    std::thread receive_thread_;
+    // 已接收数据包数量
+    std::atomic<uint64_t> packet_count_{0};
+
+private:
+    /**
+     * 构造函数
+     */
+    IpcIngest() = default;
+
+    /**
+     * 接收数据的线程函数
+     * @param listen_fd 监听套接字
+     */
+    void receive_thread(int listen_fd);
+
+    /**
+     * 分发数据包
+     * @param packet 数据包
+     * @param length 数据包长度
+     */
+    void dispatch(const char *packet, size_t length);
+};
+
+#endif //RSMSAPP_IPC_INGEST_H
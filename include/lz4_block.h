@@ -0,0 +1,30 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+
+#ifndef RSMSAPP_LZ4_BLOCK_H
+#define RSMSAPP_LZ4_BLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * LZ4块格式压缩（贪心匹配），结果可由标准LZ4库的LZ4_decompress_safe解压
+ * @param data 数据
+ * @param length 数据长度
+ * @param out 压缩结果，追加在已有内容之后
+ */
+void lz4_compress_block(const uint8_t *data, size_t length, std::vector<uint8_t> &out);
+
+/**
+ * LZ4块格式解压
+ * @param data 压缩数据
+ * @param length 压缩数据长度
+ * @param raw_length 解压后长度
+ * @param out 解压结果，追加在已有内容之后
+ * @return 是否解压成功，数据损坏或解压后长度不符时失败
+ */
+bool lz4_decompress_block(const uint8_t *data, size_t length, size_t raw_length, std::vector<uint8_t> &out);
+
+#endif //RSMSAPP_LZ4_BLOCK_H
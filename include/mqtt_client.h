@@ -5,23 +5,71 @@
 #ifndef RSMSAPP_MQTT_CLIENT_H
 #define RSMSAPP_MQTT_CLIENT_H
 
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "mosquitto/mosquitto.h"
-#include "mosquitto/mosquittopp.h"
+#include "mosquitto/mqtt_protocol.h"
 #include "yaml-cpp/yaml.h"
 
 #include "mqtt_message_handler.h"
+#include "mqtt_publish_listener.h"
+#include "mqtt_topic_router.h"
+#include "rsms_latency_histogram.h"
+#include "rsms_mpsc_queue.h"
+
+struct ssl_ctx_st;
+struct ssl_session_st;
+
+// 异步发布提交结果
+enum publish_status_t {
+    PUBLISH_QUEUED = 0, // 已进入发布队列，结果通过发布监听器回调
+    PUBLISH_QUEUE_FULL = 1, // 发布队列已满，调用方保留消息稍后重试
+    PUBLISH_DISCONNECTED = 2, // 未连接
+    PUBLISH_INVALID = 3, // 主题或数据为空
+};
+
+// 主题收发统计
+struct mqtt_topic_metrics_t {
+    uint64_t sent = 0; // 已发布
+    uint64_t acked = 0; // 已确认（QOS>0）
+    uint64_t failed = 0; // 未连接或发布出错，未能发布
+    uint64_t rejected = 0; // 发布队列已满被拒绝，由调用方保留重试
+    uint64_t dropped = 0; // 已发布未确认时连接断开，随连接丢失
+    uint64_t received = 0; // 收到的消息
+    uint64_t bytes_out = 0; // 已发布的数据字节数
+    uint64_t bytes_in = 0; // 收到的数据字节数
+    RsmsLatencyHistogram latency; // 提交发布到收到PUBACK的时延（微秒），每次导出后清空
+};
 
 /**
  * MQTT客户端
+ * 每个实例为一条独立的连接，有各自的配置、网络线程与重连策略：
+ * 本地连接（local）订阅MCU数据，上行连接（uplink）发布国标消息并订阅TSP连接状态，上行阻塞不影响本地接入
+ * 可选TLS：TLS上下文跨重连复用，保存最近一次会话（可持久化到文件），重连时恢复会话以省去完整握手
+ * 可选MQTT v5：使用主题别名减少重复发送的主题字节，支持单条消息过期时间，在途窗口取配置与服务端接收上限的较小值
+ * 重连：连接断开后立即重试一次，之后按带去相关抖动的指数退避重试，收到网络恢复通知时重置退避立即重连
  */
-class MqttClient : public mosqpp::mosquittopp {
+class MqttClient {
 public:
     /**
-     * 析构虚函数
+     * 构造函数
+     * @param name 连接名称，对应配置mqtt下的同名配置块
+     * @param client_id_suffix 未单独配置客户端ID时追加在公共客户端ID后的后缀
      */
-    ~MqttClient() override;
+    MqttClient(std::string name, std::string client_id_suffix);
+
+    /**
+     * 析构函数
+     */
+    ~MqttClient();
 
     /**
      * 防止对象被复制
@@ -35,19 +83,33 @@ public:
     MqttClient &operator=(const MqttClient &) = delete;
 
     /**
-     * 获取单例
-     * @return 单例
+     * 获取本地连接
+     * @return 本地连接
+     */
+    static MqttClient &get_local();
+
+    /**
+     * 获取上行连接
+     * @return 上行连接
      */
-    static MqttClient &get_instance();
+    static MqttClient &get_uplink();
 
 public:
     /**
-     * 加载配置
+     * 加载配置，先加载mqtt下的公共配置，再以mqtt下同名配置块覆盖
      * @param config 配置信息
      * @return 是否加载成功
      */
     bool load_config(const YAML::Node &config);
 
+    /**
+     * 添加订阅，启动前调用，每次连接成功后订阅
+     * @param topic 主题
+     * @param handler 处理器
+     * @param qos 消息质量
+     */
+    void add_subscription(const std::string &topic, MqttMessageHandler &handler, int qos = 1);
+
     /**
      * 启动
      * @return 启动是否成功
@@ -66,59 +128,90 @@ public:
     bool is_connected() const;
 
     /**
-     * 发布
-     * @param mid 消息ID
+     * 异步发布，消息进入发布队列后由网络线程整批发布，发布结果与确认通过发布监听器回调
      * @param topic 主题
-     * @param payload 数据
-     * @param payload_len 数据长度
+     * @param payload 数据，提交失败时不移动
      * @param qos 消息质量
-     * @return 是否发布成功
+     * @param token 标识，回调时原样返回
+     * @param expiry_second 消息过期秒数（MQTT v5），超时未投递的消息由服务端丢弃，0为不过期
+     * @return 提交结果
      */
-    bool publish(int &mid, const std::string &topic, const void *payload = nullptr, int payload_len = 0, int qos = 1);
+    publish_status_t publish(const std::string &topic, std::vector<uint8_t> &&payload, int qos = 1,
+                             uint64_t token = 0, uint32_t expiry_second = 0);
 
     /**
-     * 发布
-     * @param mid 消息ID
-     * @param topic 主题
-     * @param payload 数据
-     * @param qos 消息质量
-     * @return 是否发布成功
+     * 设置消息发布监听器
+     * @param listener 监听器
      */
-    bool publish(int &mid, const std::string &topic, std::vector<uint8_t> *payload = nullptr, int qos = 1);
-
-    void on_connect(int rc) override;
+    void set_publish_listener(MqttPublishListener *listener);
 
-    void on_disconnect(int rc) override;
-
-    void on_publish(int mid) override;
+    /**
+     * 获取各主题收发统计
+     * @return 主题 -> 统计，计数为累计值，时延为上次导出以来的值
+     */
+    std::map<std::string, mqtt_topic_metrics_t> get_topic_metrics();
 
-    void on_message(const struct mosquitto_message *message) override;
+    /**
+     * 网络恢复通知，未连接时重置退避并立即重连，可在任意线程调用
+     */
+    void notify_network_up();
 
-    void on_subscribe(int mid, int qos_count, const int *granted_qos) override;
+    /**
+     * 获取网络恢复通知主题，由其他连接订阅后调用notify_network_up
+     * @return 主题，未配置时为空
+     */
+    const std::string &get_network_up_topic() const;
 
-    void on_unsubscribe(int mid) override;
+private:
+    // 连接状态
+    enum connect_state_t {
+        CONNECT_STATE_DISCONNECTED = 0, // 未连接，等待下次重连时间
+        CONNECT_STATE_CONNECTING = 1, // 已发起连接，等待CONNACK
+        CONNECT_STATE_CONNECTED = 2, // 已连接
+    };
 
-    void on_log(int level, const char *str) override;
 
-    void on_error() override;
+    // 订阅
+    struct subscription_t {
+        std::string topic; // 主题
+        MqttMessageHandler *handler; // 处理器
+        int qos; // 消息质量
+    };
 
-private:
+    // libmosquitto客户端
+    struct mosquitto *mosq_ = nullptr;
+    // 连接名称
+    std::string name_;
+    // 未单独配置客户端ID时的后缀
+    std::string client_id_suffix_;
+    // 订阅
+    std::vector<subscription_t> subscriptions_;
     // 是否初始化
     std::atomic_bool is_inited_{false};
     // 是否启动
     std::atomic_bool is_started_{false};
     // 是否连接
     std::atomic_bool is_connected_{false};
-    // 是否连接中
-    std::atomic_bool is_connecting_{false};
+    // 连接状态，仅网络线程访问
+    connect_state_t connect_state_ = CONNECT_STATE_DISCONNECTED;
     // 是否订阅
     std::atomic_bool is_subscribed_{false};
     // 连接器
     std::thread connector;
-    // 轮询锁
-    std::mutex mtx_loop_;
-    // 轮询条件
-    std::condition_variable cv_loop_;
+    // 事件循环epoll描述符
+    int epoll_fd_ = -1;
+    // 跨线程唤醒事件描述符（eventfd）
+    int wake_fd_ = -1;
+    // 按保活、连接超时与统计导出中最近的截止时间触发的单次定时器描述符（timerfd）
+    int timer_fd_ = -1;
+    // 定时器当前的截止时间，未启动时为最大值，仅网络线程访问
+    std::chrono::steady_clock::time_point timer_deadline_ = std::chrono::steady_clock::time_point::max();
+    // 下次处理保活的时间，间隔为保持连接时间的一半，仅网络线程访问
+    std::chrono::steady_clock::time_point next_keepalive_time_;
+    // 已注册到epoll的MQTT套接字
+    int registered_socket_ = -1;
+    // 已注册的MQTT套接字事件
+    uint32_t registered_events_ = 0;
     // 服务器地址
     std::string server_host_ = "127.0.0.1";
     // 服务器端口
@@ -133,18 +226,166 @@ private:
     std::string password_ = "RsmsApp";
     // 使用SSL
     bool use_ssl_ = false;
-    // 消息处理器
-    std::unordered_map<std::string, MqttMessageHandler*> message_handler_;
-    // 主题前缀
-    std::string topic_prefix_ = "RSMS/";
-    // 重连间隔时间
+    // CA证书文件
+    std::string ca_file_;
+    // 客户端证书文件，为空时不使用客户端证书
+    std::string cert_file_;
+    // 客户端私钥文件
+    std::string key_file_;
+    // TLS会话持久化文件，为空时只在进程内复用会话
+    std::string tls_session_file_;
+    // TLS上下文，跨重连复用
+    struct ssl_ctx_st *ssl_ctx_ = nullptr;
+    // 最近一次可恢复的TLS会话，仅网络线程访问
+    struct ssl_session_st *tls_session_ = nullptr;
+    // TLS完整握手次数
+    size_t tls_full_count_ = 0;
+    // TLS会话恢复次数
+    size_t tls_resumed_count_ = 0;
+    // 消息路由
+    MqttTopicRouter topic_router_;
+    // 消息发布监听器
+    std::atomic<MqttPublishListener *> publish_listener_{nullptr};
+    // 重连退避上限
     int reconnect_interval_second_ = 15;
-    // 轮询间隔时间
-    int loop_interval_milli_second_ = 100;
+    // 重连退避基础间隔
+    int reconnect_base_milli_second_ = 1000;
+    // 等待CONNACK的超时时间
+    int connect_timeout_second_ = 30;
+    // 停止时等待已提交消息发出并确认的最长时间
+    int stop_drain_milli_second_ = 3000;
+    // 下次发起连接的时间，仅网络线程访问
+    std::chrono::steady_clock::time_point next_connect_time_;
+    // 本次连接等待CONNACK的截止时间，仅网络线程访问
+    std::chrono::steady_clock::time_point connect_deadline_;
+    // 断开（首次连接时为启动）的时间，仅网络线程访问
+    std::chrono::steady_clock::time_point disconnected_time_;
+    // 上一次退避时长，仅网络线程访问
+    std::chrono::milliseconds backoff_{0};
+    // 本次断开后的连接尝试次数，仅网络线程访问
+    int connect_attempts_ = 0;
+    // 退避抖动随机数，仅网络线程访问
+    std::minstd_rand backoff_random_;
+    // 是否收到网络恢复通知
+    std::atomic_bool is_network_up_{false};
+    // 网络恢复通知主题
+    std::string network_up_topic_;
+    // 网络恢复通知文件，文件修改时间变化视为网络恢复
+    std::string network_up_file_;
+    // 网络恢复通知文件最近一次的修改时间，仅网络线程访问
+    long long network_up_file_mtime_ = 0;
+    // 是否曾经连接成功，仅网络线程访问
+    bool has_connected_ = false;
+    // 重连成功次数
+    size_t reconnect_count_ = 0;
+    // 重连累计耗时
+    long long reconnect_total_milli_second_ = 0;
+    // 重连最大耗时
+    long long reconnect_max_milli_second_ = 0;
+    // 待发布消息
+    struct publish_request_t {
+        std::string topic; // 主题
+        std::vector<uint8_t> payload; // 数据
+        int qos; // 消息质量
+        uint64_t token; // 标识
+        uint32_t expiry_second; // 消息过期秒数
+        std::chrono::steady_clock::time_point submit_time; // 提交时间
+    };
+    // 已发布未确认的消息
+    struct publish_inflight_t {
+        mqtt_topic_metrics_t *metrics; // 所属主题的统计
+        std::chrono::steady_clock::time_point submit_time; // 提交时间
+    };
+    // 发布队列，各线程无锁提交，网络线程整批取出发布
+    RsmsMpscQueue<publish_request_t> publish_queue_;
+    // 网络线程已取出、因在途数量达到上限暂缓发布的消息
+    std::deque<publish_request_t> publish_pending_;
+    // 网络线程整批取出的消息，复用内存
+    std::vector<publish_request_t> publish_batch_;
+    // 已提交未发布的消息数量
+    std::atomic<size_t> publish_depth_{0};
+    // 已发布未确认（QOS>0）的消息，仅网络线程访问
+    std::map<int, publish_inflight_t> publish_inflight_;
+    // 发布队列深度上限
+    size_t max_publish_queue_depth_ = 256;
+    // 已发布未确认的消息数量上限
+    size_t max_inflight_messages_ = 128;
+    // 是否使用MQTT v5
+    bool use_mqtt5_ = false;
+    // 本次连接的在途上限，取配置与服务端接收上限的较小值，仅网络线程访问
+    size_t send_maximum_ = 128;
+    // 本次连接服务端允许的主题别名上限，0为不使用别名，仅网络线程访问
+    uint16_t topic_alias_maximum_ = 0;
+    // 本次连接已建立的主题别名，仅网络线程访问
+    std::map<std::string, uint16_t> topic_aliases_;
+    // 统计锁
+    std::mutex metrics_mutex_;
+    // 各主题收发统计，只增不删，访问时持有统计锁
+    std::map<std::string, mqtt_topic_metrics_t> topic_metrics_;
+    // 统计导出间隔，0为不导出
+    int metrics_interval_second_ = 60;
+    // 统计导出主题，为空时只写日志
+    std::string metrics_topic_;
+    // 上次导出统计的时间，仅网络线程访问
+    std::chrono::steady_clock::time_point last_metrics_time_;
 
 private:
+    /**
+     * 加载连接配置
+     * @param node 配置块
+     */
+    void load_connection_config(const YAML::Node &node);
+
+    /**
+     * 连接结果回调
+     * @param rc 连接结果
+     * @param properties CONNACK属性（MQTT v5）
+     */
+    void on_connect(int rc, const mosquitto_property *properties);
+
+    /**
+     * 连接断开回调
+     * @param rc 断开原因
+     */
+    void on_disconnect(int rc);
+
+    /**
+     * 消息发布完成回调（QOS1为收到PUBACK）
+     * @param mid 消息ID
+     * @param reason_code 原因码（MQTT v5）
+     */
+    void on_publish(int mid, int reason_code);
+
+    /**
+     * 收到消息回调
+     * @param message 消息
+     */
+    void on_message(const struct mosquitto_message *message);
+
+    /**
+     * 设置libmosquitto回调
+     */
+    void set_callbacks();
 
-    MqttClient();
+    /**
+     * 创建TLS上下文并加载持久化的会话（仅网络线程调用）
+     * @return 是否创建成功
+     */
+    bool init_tls();
+
+    /**
+     * 收到新的可恢复TLS会话（TLS1.3在握手后由服务端下发）
+     * @param session 会话，由本对象持有
+     */
+    void on_tls_session(struct ssl_session_st *session);
+
+    /**
+     * 发布一条消息，服务端支持时使用主题别名（仅网络线程调用）
+     * @param request 消息
+     * @param mid 消息ID
+     * @return libmosquitto返回码
+     */
+    int publish_request(const publish_request_t &request, int &mid);
 
     /**
      * 初始化
@@ -157,6 +398,76 @@ private:
      */
     void connect_manage();
 
+    /**
+     * 按退避策略安排下次连接（仅网络线程调用）：断开后首次立即重试，之后在[基础间隔, 上次退避的3倍]中随机取值，不超过上限
+     */
+    void schedule_reconnect();
+
+    /**
+     * 检查网络恢复通知（通知接口或通知文件），收到时重置退避（仅网络线程调用）
+     * @return 是否收到网络恢复通知
+     */
+    bool check_network_up();
+
+    /**
+     * 未连接时等待到下次连接时间，期间响应停止与网络恢复通知（仅网络线程调用）
+     */
+    void wait_reconnect();
+
+    /**
+     * 创建事件循环使用的epoll、eventfd与timerfd
+     * @return 是否创建成功
+     */
+    bool init_event_loop();
+
+    /**
+     * 按保活、连接超时与统计导出中最近的截止时间启动定时器，截止时间未变时不重复设置（仅网络线程调用）
+     */
+    void arm_timer();
+
+    /**
+     * 关闭事件循环使用的描述符
+     */
+    void close_event_loop();
+
+    /**
+     * 唤醒事件循环，使其重新检查是否有待发送数据
+     */
+    void wake();
+
+    /**
+     * 等待唤醒或超时
+     * @param timeout_ms 超时时间
+     */
+    void wait_wake(int timeout_ms);
+
+    /**
+     * 等待并处理一轮套接字、定时器与唤醒事件
+     */
+    void poll_events();
+
+    /**
+     * 发布队列中的消息（仅网络线程调用），多条消息合并为尽量少的TCP报文段，未连接时全部回调失败
+     */
+    void flush_publishes();
+
+    /**
+     * 停止前发布已提交的消息，写完套接字缓冲并在限定时间内等待确认（仅网络线程调用）
+     */
+    void drain_publishes();
+
+    /**
+     * 获取主题统计（调用方持有统计锁）
+     * @param topic 主题
+     * @return 统计
+     */
+    mqtt_topic_metrics_t &topic_metrics(const std::string &topic);
+
+    /**
+     * 到达导出间隔时输出各主题统计，配置了导出主题时以JSON发布，之后清空时延直方图（仅网络线程调用）
+     */
+    void export_metrics();
+
     /**
      * 连接
      * @return 是否连接成功
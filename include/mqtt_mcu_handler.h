@@ -4,7 +4,46 @@
 
 #ifndef RSMSAPP_MQTT_MCU_HANDLER_H
 #define RSMSAPP_MQTT_MCU_HANDLER_H
+#include <cstdint>
+#include <string>
+
 #include "mqtt_message_handler.h"
+#include "rsms_data_v2.pb.h"
+
+class MqttMcuHandler;
+
+// MCU消息格式（v1全量数据由MqttMcuHandler自身处理）
+enum mcu_format_t {
+    MCU_FORMAT_V2_DELTA = 0, // v2增量数据
+    MCU_FORMAT_V2_FAST = 1, // v2高频数据
+    MCU_FORMAT_V2_POSITION = 2, // v2位置数据
+    MCU_FORMAT_V2_CELL = 3, // v2单体电压数据
+    MCU_FORMAT_V2_SLOW = 4, // v2低频数据
+    MCU_FORMAT_COUNT = 5, // 格式数量
+};
+
+/**
+ * 处理MCU来的指定格式MQTT消息，转交给MqttMcuHandler对应的解析函数
+ */
+class MqttMcuFormatHandler : public MqttMessageHandler {
+public:
+    // 解析函数
+    typedef void (MqttMcuHandler::*handle_func_t)(const std::string &payload);
+
+    MqttMcuFormatHandler(MqttMcuHandler &owner, handle_func_t handle_func);
+
+    /**
+     * 处理MCU消息
+     * @param payload 数据
+     */
+    void handle(std::string payload) override;
+
+private:
+    // 所属MCU消息处理器
+    MqttMcuHandler &owner_;
+    // 解析函数
+    handle_func_t handle_func_;
+};
 
 /**
  * 处理MCU来的MQTT消息
@@ -34,11 +73,72 @@ public:
     static MqttMcuHandler &get_instance();
 public:
     /**
-     * 处理MCU消息
+     * 处理MCU消息（v1全量数据）
      * @param payload 数据
      */
     void handle(std::string payload) override;
+
+    /**
+     * 获取指定格式的消息处理器
+     * @param format 消息格式
+     * @return 消息处理器
+     */
+    MqttMessageHandler &format_handler(mcu_format_t format);
+
+    /**
+     * 处理v2增量数据，直接将变化的信号写入信号缓存
+     * @param payload 数据
+     */
+    void handle_delta(const std::string &payload);
+
+    /**
+     * 处理v2高频数据
+     * @param payload 数据
+     */
+    void handle_fast(const std::string &payload);
+
+    /**
+     * 处理v2位置数据
+     * @param payload 数据
+     */
+    void handle_position(const std::string &payload);
+
+    /**
+     * 处理v2单体电压数据
+     * @param payload 数据
+     */
+    void handle_cell(const std::string &payload);
+
+    /**
+     * 处理v2低频数据
+     * @param payload 数据
+     */
+    void handle_slow(const std::string &payload);
 private:
+    // 各格式消息处理器，按mcu_format_t排列
+    MqttMcuFormatHandler format_handlers_[MCU_FORMAT_COUNT] = {
+            {*this, &MqttMcuHandler::handle_delta},
+            {*this, &MqttMcuHandler::handle_fast},
+            {*this, &MqttMcuHandler::handle_position},
+            {*this, &MqttMcuHandler::handle_cell},
+            {*this, &MqttMcuHandler::handle_slow},
+    };
+    // 以下消息对象在MQTT轮询线程中复用，避免每帧重新分配
+    // 增量数据
+    tbox::mcu::rsms::v2::RsmsDelta delta_;
+    // 高频数据
+    tbox::mcu::rsms::v2::FastData fast_;
+    // 位置数据
+    tbox::mcu::rsms::v2::PositionData position_;
+    // 单体电压数据
+    tbox::mcu::rsms::v2::CellData cell_;
+    // 低频数据
+    tbox::mcu::rsms::v2::SlowData slow_;
+    // 是否收到过关键帧
+    bool has_keyframe_ = false;
+    // 上一帧序号
+    uint32_t last_sequence_ = 0;
+
     MqttMcuHandler() = default;
 };
 #endif //RSMSAPP_MQTT_MCU_HANDLER_H
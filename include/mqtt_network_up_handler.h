@@ -0,0 +1,45 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+
+#ifndef RSMSAPP_MQTT_NETWORK_UP_HANDLER_H
+#define RSMSAPP_MQTT_NETWORK_UP_HANDLER_H
+#include <string>
+#include "mqtt_message_handler.h"
+
+/**
+ * 处理本地网络管理服务来的网络恢复消息，经本地连接订阅，通知上行连接重置退避立即重连
+ */
+class MqttNetworkUpHandler : public MqttMessageHandler {
+public:
+    /**
+     * 析构虚函数
+     */
+    ~MqttNetworkUpHandler() override = default;
+
+    /**
+     * 防止对象被复制
+     */
+    MqttNetworkUpHandler(const MqttNetworkUpHandler &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    MqttNetworkUpHandler &operator=(const MqttNetworkUpHandler &) = delete;
+
+    /**
+     * 获取单例
+     * @return 单例
+     */
+    static MqttNetworkUpHandler &get_instance();
+public:
+    /**
+     * 处理网络恢复消息
+     * @param payload 数据
+     */
+    void handle(std::string payload) override;
+private:
+    MqttNetworkUpHandler() = default;
+};
+#endif //RSMSAPP_MQTT_NETWORK_UP_HANDLER_H
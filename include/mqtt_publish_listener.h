@@ -0,0 +1,34 @@
+//
+// Created by hwyz_leo on 2025/8/31.
+//
+
+#ifndef RSMSAPP_MQTT_PUBLISH_LISTENER_H
+#define RSMSAPP_MQTT_PUBLISH_LISTENER_H
+
+#include <cstdint>
+
+class MqttPublishListener {
+public:
+    /**
+     * 发布队列中的消息已交给网络层或发布失败（网络线程回调，早于该消息的确认）
+     * @param token 提交时的标识
+     * @param mid 消息ID，失败时为0
+     * @param is_success 是否发布成功
+     */
+    virtual void on_publish_sent(uint64_t token, int mid, bool is_success) = 0;
+
+    /**
+     * 消息发布完成（QOS1为收到PUBACK）
+     * @param mid 消息ID
+     */
+    virtual void on_publish_ack(int mid) = 0;
+
+    /**
+     * 连接断开，未确认的消息不会再收到确认
+     */
+    virtual void on_connection_lost() = 0;
+
+    virtual ~MqttPublishListener() = default;
+};
+
+#endif //RSMSAPP_MQTT_PUBLISH_LISTENER_H
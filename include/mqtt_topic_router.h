@@ -0,0 +1,131 @@
+//
+// Created by hwyz_leo on 2025/8/26.
+//
+
+#ifndef RSMSAPP_MQTT_TOPIC_ROUTER_H
+#define RSMSAPP_MQTT_TOPIC_ROUTER_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mqtt_message_handler.h"
+
+/**
+ * MQTT主题路由
+ * 按主题层级构建前缀树，支持MQTT通配符（+单层、#多层）
+ * 不含通配符的主题在订阅时固化，收到消息时只需比较哈希与长度，查找过程不分配内存
+ * 非线程安全，添加与查找需在同一线程（MQTT轮询线程）中进行
+ */
+class MqttTopicRouter {
+public:
+    MqttTopicRouter();
+
+    ~MqttTopicRouter();
+
+    /**
+     * 防止对象被复制
+     */
+    MqttTopicRouter(const MqttTopicRouter &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    MqttTopicRouter &operator=(const MqttTopicRouter &) = delete;
+
+public:
+    /**
+     * 添加路由，重复添加同一主题时覆盖原处理器
+     * @param topic_filter 订阅主题（可含通配符）
+     * @param handler 处理器
+     * @return 是否添加成功
+     */
+    bool add(const std::string &topic_filter, MqttMessageHandler &handler);
+
+    /**
+     * 移除路由
+     * @param topic_filter 订阅主题（可含通配符）
+     * @return 是否移除成功
+     */
+    bool remove(const std::string &topic_filter);
+
+    /**
+     * 清空路由
+     */
+    void clear();
+
+    /**
+     * 查找主题对应的处理器
+     * 优先级：精确匹配 > 单层通配符 > 多层通配符
+     * @param topic 消息主题
+     * @return 处理器，未匹配返回空指针
+     */
+    MqttMessageHandler *route(const char *topic) const;
+
+    /**
+     * 路由数量
+     * @return 路由数量
+     */
+    size_t size() const;
+
+private:
+    // 前缀树节点
+    struct node_t {
+        // 本层主题
+        std::string level;
+        // 处理器
+        MqttMessageHandler *handler = nullptr;
+        // 普通子节点
+        std::vector<std::unique_ptr<node_t>> children;
+        // 单层通配符子节点
+        std::unique_ptr<node_t> plus;
+        // 多层通配符子节点
+        std::unique_ptr<node_t> hash;
+    };
+
+    // 固化的精确主题
+    struct exact_route_t {
+        // 主题
+        std::string topic;
+        // 主题哈希
+        size_t topic_hash;
+        // 处理器
+        MqttMessageHandler *handler;
+    };
+
+    // 前缀树根节点
+    node_t root_;
+    // 精确主题列表
+    std::vector<exact_route_t> exact_routes_;
+    // 通配符路由数量
+    size_t wildcard_count_ = 0;
+
+private:
+    /**
+     * 校验订阅主题是否合法
+     * @param topic_filter 订阅主题
+     * @return 是否合法
+     */
+    static bool is_valid_filter(const std::string &topic_filter);
+
+    /**
+     * 计算主题哈希（FNV-1a）
+     * @param topic 主题
+     * @param length 主题长度
+     * @return 哈希值
+     */
+    static size_t hash_topic(const char *topic, size_t length);
+
+    /**
+     * 递归匹配前缀树
+     * @param node 当前节点
+     * @param level 当前层起始位置
+     * @param is_first_level 是否首层
+     * @return 处理器，未匹配返回空指针
+     */
+    static MqttMessageHandler *match(const node_t *node, const char *level, bool is_first_level);
+};
+
+#endif //RSMSAPP_MQTT_TOPIC_ROUTER_H
@@ -0,0 +1,137 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+
+#ifndef RSMSAPP_MQTT_TRACE_H
+#define RSMSAPP_MQTT_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "spdlog/spdlog.h"
+#include "spdlog/async.h"
+#include "spdlog/sinks/ringbuffer_sink.h"
+#include "yaml-cpp/yaml.h"
+
+/**
+ * MQTT收发跟踪
+ * 每条发布、确认与接收写入异步日志，输出到与默认日志相同的位置，先按级别判断再格式化，网络线程不等待日志输出
+ * 载荷按1/N或按主题采样，十六进制内容写入内存环形缓冲，停止时保存到文件
+ */
+class MqttTrace {
+public:
+    /**
+     * 析构函数
+     */
+    ~MqttTrace() = default;
+
+    /**
+     * 防止对象被复制
+     */
+    MqttTrace(const MqttTrace &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    MqttTrace &operator=(const MqttTrace &) = delete;
+
+    /**
+     * 获取单例
+     * @return 单例
+     */
+    static MqttTrace &get_instance();
+
+public:
+    /**
+     * 加载配置
+     * @param config 配置信息
+     * @return 是否加载成功
+     */
+    bool load_config(const YAML::Node &config);
+
+    /**
+     * 启动，在默认日志配置完成后、MQTT客户端启动前调用
+     * @return 启动是否成功
+     */
+    bool start();
+
+    /**
+     * 停止，输出剩余日志并保存采样的载荷
+     */
+    void stop();
+
+    /**
+     * 跟踪发布
+     * @param client 连接名称
+     * @param mid 消息ID
+     * @param topic 主题
+     * @param qos 消息质量
+     * @param payload 数据
+     */
+    void trace_publish(const std::string &client, int mid, const std::string &topic, int qos,
+                       const std::vector<uint8_t> &payload);
+
+    /**
+     * 跟踪发布确认
+     * @param client 连接名称
+     * @param mid 消息ID
+     */
+    void trace_ack(const std::string &client, int mid);
+
+    /**
+     * 跟踪接收
+     * @param client 连接名称
+     * @param topic 主题
+     * @param payload 数据
+     * @param length 数据长度
+     */
+    void trace_receive(const std::string &client, const char *topic, const void *payload, size_t length);
+
+    /**
+     * 获取最近采样的载荷
+     * @return 采样记录，由旧到新
+     */
+    std::vector<std::string> get_samples();
+
+private:
+    MqttTrace() = default;
+
+    /**
+     * 是否采样本条消息的载荷
+     * @param topic 主题
+     * @return 是否采样
+     */
+    bool should_sample(const std::string &topic);
+
+    // 是否启动
+    std::atomic_bool is_started_{false};
+    // 收发跟踪级别，每条发布、确认与接收为debug级别
+    spdlog::level::level_enum level_ = spdlog::level::info;
+    // 异步日志队列长度，队列已满时丢弃最早的日志
+    size_t queue_size_ = 8192;
+    // 每N条消息采样一条载荷，0为不按比例采样
+    uint64_t sample_every_ = 0;
+    // 载荷全部采样的主题
+    std::set<std::string> sample_topics_;
+    // 环形缓冲保存的采样条数
+    size_t sample_ring_size_ = 256;
+    // 停止时保存采样载荷的文件，为空时不保存
+    std::string sample_file_;
+    // 消息计数，用于按比例采样
+    std::atomic<uint64_t> message_count_{0};
+    // 异步日志线程池
+    std::shared_ptr<spdlog::details::thread_pool> thread_pool_;
+    // 收发跟踪日志
+    std::shared_ptr<spdlog::logger> logger_;
+    // 载荷采样日志
+    std::shared_ptr<spdlog::logger> sample_logger_;
+    // 载荷采样环形缓冲
+    std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt> sample_sink_;
+};
+
+#endif //RSMSAPP_MQTT_TRACE_H
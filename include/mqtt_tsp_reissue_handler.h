@@ -0,0 +1,45 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+
+#ifndef RSMSAPP_MQTT_TSP_REISSUE_HANDLER_H
+#define RSMSAPP_MQTT_TSP_REISSUE_HANDLER_H
+#include <string>
+#include "mqtt_message_handler.h"
+
+/**
+ * 处理TSP服务来的按时间范围补发消息，数据为JSON：{"start_time": 开始时间（秒）, "end_time": 结束时间（秒，含）}
+ */
+class MqttTspReissueHandler : public MqttMessageHandler {
+public:
+    /**
+     * 析构虚函数
+     */
+    ~MqttTspReissueHandler() override = default;
+
+    /**
+     * 防止对象被复制
+     */
+    MqttTspReissueHandler(const MqttTspReissueHandler &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    MqttTspReissueHandler &operator=(const MqttTspReissueHandler &) = delete;
+
+    /**
+     * 获取单例
+     * @return 单例
+     */
+    static MqttTspReissueHandler &get_instance();
+public:
+    /**
+     * 处理按时间范围补发消息
+     * @param payload 数据
+     */
+    void handle(std::string payload) override;
+private:
+    MqttTspReissueHandler() = default;
+};
+#endif //RSMSAPP_MQTT_TSP_REISSUE_HANDLER_H
@@ -6,10 +6,24 @@
 #define RSMSAPP_RSMS_CLIENT_H
 
 #include <vector>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
 
+#include "yaml-cpp/yaml.h"
+
+#include "rsms_frame_ring.h"
+#include "rsms_mpsc_queue.h"
+#include "rsms_rate_controller.h"
+#include "rsms_reissue_envelope.h"
+#include "rsms_reissue_index.h"
+#include "rsms_reissue_store.h"
+#include "rsms_uplink_scheduler.h"
+
 // 国标命令标识
 enum command_flag_t {
     VEHICLE_LOGIN = 0x01, // 车辆登录
@@ -45,7 +59,7 @@ enum data_info_type_t {
     BATTERY_TEMPERATURE = 0x09, // 可充电储能装置温度数据
 };
 
-class RsmsClient {
+class RsmsClient : public RsmsUplinkListener {
 public:
     /**
      * 析构虚函数
@@ -70,6 +84,13 @@ public:
     static RsmsClient &get_instance();
 
 public:
+    /**
+     * 加载配置
+     * @param config 配置信息
+     * @return 是否加载成功
+     */
+    bool load_config(const YAML::Node &config);
+
     /**
      * 启动
      * @return 启动是否成功
@@ -87,6 +108,35 @@ public:
      */
     void stop();
 
+    /**
+     * 请求按采集时间范围补发，由补发线程在登录后执行
+     * @param start_time 开始时间（秒）
+     * @param end_time 结束时间（秒，含）
+     * @return 是否接受请求
+     */
+    bool request_time_range(long long start_time, long long end_time);
+
+    /**
+     * 消息已发送或发送失败，发送失败的补发数据重新发送，报警数据转为补发
+     * @param type 优先级
+     * @param tag 补发数据为存储序号，报警数据为报警数据标识
+     * @param is_success 是否发送成功
+     */
+    void on_uplink_sent(uplink_class_t type, uint64_t tag, bool is_success) override;
+
+    /**
+     * 消息已确认，确认对应的补发数据并调整补发速率
+     * @param type 优先级
+     * @param tag 补发数据为存储序号，报警数据为报警数据标识
+     * @param latency 发送到确认的时延
+     */
+    void on_uplink_ack(uplink_class_t type, uint64_t tag, std::chrono::steady_clock::duration latency) override;
+
+    /**
+     * 连接断开，未确认的补发数据重连后重新发送，未确认的报警数据转为补发
+     */
+    void on_uplink_lost() override;
+
 private:
     // 是否初始化
     std::atomic_bool is_init_{false};
@@ -110,8 +160,32 @@ private:
     std::string battery_pack_sn_;
     // 配置文件路径
     std::string config_file_path_ = "/tmp/rsms_client.config";
-    // 数据文件路径
+    // 数据文件路径（旧版本补发数据文件，启动时导入补发日志后删除）
     std::string data_file_path_ = "/tmp/rsms_message.dat";
+    // 补发数据存储方式：ring为固定大小的环形存储，wal为按段追加的日志
+    std::string reissue_store_type_ = "ring";
+    // 补发数据存储路径，为空时按存储方式使用默认路径
+    std::string reissue_store_path_;
+    // 补发数据存储大小（MB），wal方式为单段大小
+    int reissue_store_mb_ = 16;
+    // 补发数据定时落盘间隔
+    int reissue_sync_interval_ms_ = 500;
+    // 是否压缩补发数据（关键帧+差分帧）
+    bool is_reissue_compress_ = true;
+    // 补发数据关键帧最大间隔条数
+    int reissue_keyframe_interval_ = 32;
+    // 补发数据时间索引间隔秒数
+    int reissue_index_interval_second_ = 60;
+    // 补发数据保留小时数，为0时不清理
+    int reissue_retention_hour_ = 168;
+    // 补发数据存储
+    std::unique_ptr<RsmsReissueStore> reissue_store_;
+    // 补发数据时间索引，为补发数据存储的最外层
+    RsmsReissueIndex *reissue_index_ = nullptr;
+    // 补发数据队列，采集、报警与发送失败等生产者无锁追加，补发线程整批写入补发数据存储
+    RsmsMpscQueue<std::vector<uint8_t>> reissue_queue_;
+    // 补发线程整批取出的补发数据，复用内存
+    std::vector<std::vector<uint8_t>> reissue_batch_;
     // 最后一次采集时间
     long long last_collect_timestamp_ = 0;
     // 最后一次三级报警时间
@@ -120,18 +194,91 @@ private:
     int collect_interval_ = 10;
     // 实时采集信号的线程
     std::thread collect_thread_;
-    // 补发信号锁
-    std::mutex reissue_mutex_;
     // 补发信号的线程
     std::thread reissue_thread_;
-    // 补发消息
-    std::deque<std::vector<uint8_t>> reissue_messages_;
-    // 每秒补发数量
-    int reissue_count_per_second_ = 100;
-    // 预留消息用于故障发生时补发
-    std::deque<std::vector<uint8_t>> reserve_messages_;
-    // 预留消息数量上限
-    uint8_t max_reserve_messages_ = 30;
+    // 补发速率下限（条/秒）
+    int reissue_rate_floor_ = 5;
+    // 补发速率上限（条/秒）
+    int reissue_rate_ceiling_ = 200;
+    // 补发速率每秒加性增量（条/秒）
+    int reissue_rate_step_ = 10;
+    // 补发目标确认时延，补发或实时数据确认时延超过时降低补发速率
+    int reissue_target_latency_ms_ = 1500;
+    // 补发速率控制
+    std::unique_ptr<RsmsRateController> reissue_rate_;
+    // 补发在途（已发送未确认）数量上限
+    int reissue_max_inflight_ = 100;
+    // 补发确认超时时间
+    int reissue_ack_timeout_ms_ = 10000;
+    // 一次发布合并的补发报文数量上限，大于1时以补发信封发布，速率按发布次数计
+    int reissue_batch_size_ = 1;
+    // 补发信封压缩方式
+    envelope_compression_t reissue_batch_compression_ = ENVELOPE_COMPRESSION_LZ4;
+    // 补发信封主题
+    std::string reissue_batch_topic_ = "TSP/RSMS/BATCH";
+    // 合并到补发信封的国标报文，复用内存
+    std::vector<std::vector<uint8_t>> reissue_envelope_frames_;
+    // 在途补发数据锁
+    std::mutex inflight_mutex_;
+    // 补发条件，收到确认时唤醒补发线程
+    std::condition_variable cv_reissue_;
+    // 按采集时间范围补发的读取位置
+    struct reissue_range_t {
+        long long start_time; // 开始时间（秒）
+        long long end_time; // 结束时间（秒，含）
+        bool is_located; // 是否已按时间索引定位
+        uint64_t next_sequence; // 下一条待读取的存储序号
+        uint64_t end_sequence; // 结束序号（不含）
+        size_t count; // 已提交的数据数量
+    };
+    // 待执行的按采集时间范围补发请求，按请求顺序逐个补发，访问时持有在途补发数据锁
+    std::deque<reissue_range_t> reissue_ranges_;
+    // 在途补发数据状态
+    enum reissue_state_t {
+        REISSUE_PENDING = 0, // 待（重新）发送
+        REISSUE_QUEUED = 1, // 已提交到上行消息调度
+        REISSUE_SENT = 2, // 已发送待确认
+        REISSUE_ACKED = 3, // 已确认
+    };
+    // 在途补发数据
+    struct reissue_inflight_t {
+        uint64_t sequence; // 存储序号
+        reissue_state_t state; // 状态
+        std::chrono::steady_clock::time_point sent_time; // 发送时间
+        size_t batch_count; // 同一次发布的补发数据数量，仅该次发布的首条有效，其余为0
+    };
+    // 在途补发数据，按存储序号排列
+    std::deque<reissue_inflight_t> reissue_inflight_;
+    // 按采集时间范围补发的在途数据（存储序号 -> 在途数据），每条单独发布，与在途补发数据共用在途窗口
+    std::map<uint64_t, reissue_inflight_t> range_inflight_;
+    // 补发发送任务
+    struct reissue_task_t {
+        uint64_t sequence; // 首条存储序号
+        size_t count; // 数量
+        bool is_range; // 是否为按采集时间范围补发
+    };
+    // 补发计划，在途补发数据锁内生成，锁外读取存储、编码并提交
+    struct reissue_plan_t {
+        std::vector<reissue_task_t> resend_tasks; // 重新发送的数据，已标记为已提交
+        size_t range_count = 0; // 按采集时间范围补发的新数据最多数量
+        uint64_t next_sequence = 0; // 新补发数据的起始序号
+        size_t new_count = 0; // 新补发数据最多数量
+        size_t new_batches = 0; // 新补发数据最多发布次数
+    };
+    // 确认超时重新发送的数量
+    uint64_t reissue_timeout_count_ = 0;
+    // 已确认待从存储中消费的结束序号（不含），确认在网络线程，消费在补发线程，不阻塞网络线程
+    uint64_t reissue_retire_sequence_ = 0;
+    // 预留数据帧用于故障发生时补发，访问时持有在途补发数据锁
+    RsmsFrameRing reserve_frames_{30};
+    // 未确认的报警或实时数据
+    struct reserve_pending_t {
+        uplink_class_t type; // 提交时的优先级
+        bool is_sent; // 是否已发送
+        std::vector<uint8_t> data; // 预留数据帧被覆盖时仍由上行消息调度持有，保留的数据单元副本
+    };
+    // 未确认的报警与实时数据（预留数据帧序号 -> 状态），确认前连接断开、发送失败或停止时转为补发
+    std::map<uint64_t, reserve_pending_t> reserve_pending_;
     // MQTT主题
     std::string mqtt_topic_ = "TSP/RSMS";
 
@@ -153,7 +300,7 @@ private:
     void load_config();
 
     /**
-     * 从本地文件加载数据
+     * 打开补发数据存储，导入旧版本数据文件
      */
     void load_data();
 
@@ -163,9 +310,102 @@ private:
     void save_config();
 
     /**
-     * 保存数据到本地文件
+     * 追加补发数据到补发数据队列，不阻塞
+     * @param data_unit 数据单元
+     */
+    void enqueue_reissue(std::vector<uint8_t> &&data_unit);
+
+    /**
+     * 追加补发数据到补发数据队列，不阻塞
+     * @param data 数据单元
+     * @param length 数据单元长度
+     */
+    void enqueue_reissue(const uint8_t *data, size_t length);
+
+    /**
+     * 把补发数据队列中的数据整批写入补发数据存储（仅补发线程或补发线程退出后调用）
+     * @return 写入数量
+     */
+    size_t flush_reissue_queue();
+
+    /**
+     * 未确认的报警或实时数据转为补发（调用方持有在途补发数据锁）
+     * 补发数据存储保存数据单元，直接复制预留数据帧，补发时以补发信息上报命令重新组包，无需重新编码
+     * @param sequence 预留数据帧序号
+     */
+    void spill_reserve(uint64_t sequence);
+
+    /**
+     * 预留数据帧即将被覆盖（调用方持有在途补发数据锁）
+     * 尚在上行消息调度队列中的撤回后转为补发；已取出发送的保留副本，待发送结果或确认再处理，避免重复上报
+     * @param sequence 预留数据帧序号
+     */
+    void evict_reserve(uint64_t sequence);
+
+    /**
+     * 提交补发数据到上行消息调度，多条时合并为一个补发信封（仅补发线程调用，不持有在途补发数据锁）
+     * @param data_units 数据单元
+     * @param offset 本次提交的首个数据单元位置
+     * @param count 本次提交的数据单元数量
+     * @param tag 发送结果与确认回调的标识
+     * @return 是否提交成功
      */
-    void save_data();
+    bool submit_reissue(const std::vector<std::vector<uint8_t>> &data_units, size_t offset, size_t count,
+                        uint64_t tag);
+
+    /**
+     * 生成补发计划（调用方持有在途补发数据锁）
+     * 移除已淘汰的在途数据，按令牌与在途窗口选出重新发送的数据并标记为已提交，剩余令牌优先用于按采集时间范围补发
+     * @param now 当前时间
+     * @param plan 补发计划
+     */
+    void plan_reissue(std::chrono::steady_clock::time_point now, reissue_plan_t &plan);
+
+    /**
+     * 重新发送超时或发送失败的补发数据（仅补发线程调用，不持有在途补发数据锁）
+     * @param tasks 重新发送的数据
+     */
+    void resend_reissue(const std::vector<reissue_task_t> &tasks);
+
+    /**
+     * 从最早的按采集时间范围补发请求的读取位置继续补发，上行消息调度队列已满时下次从读取位置继续
+     * 数据与顺序补发共用令牌、在途窗口与确认重发，但不消费存储，后续仍按顺序正常补发（仅补发线程调用）
+     * @param max_count 最多提交数量
+     */
+    void send_range_reissue(size_t max_count);
+
+    /**
+     * 按存储顺序发送新的补发数据（仅补发线程调用，不持有在途补发数据锁）
+     * @param next_sequence 起始序号
+     * @param max_count 最多数量
+     * @param max_batches 最多发布次数
+     */
+    void send_new_reissue(uint64_t next_sequence, size_t max_count, size_t max_batches);
+
+    /**
+     * 未能提交的补发数据恢复为待发送，下次重新发送（调用方持有在途补发数据锁）
+     * @param task 补发任务
+     */
+    void restore_pending(const reissue_task_t &task);
+
+    /**
+     * 设置同一次发布的在途补发数据状态（调用方持有在途补发数据锁）
+     * @param entry 首条在途补发数据
+     * @param state 状态
+     */
+    void set_batch_state(reissue_inflight_t &entry, reissue_state_t state);
+
+    /**
+     * 查找在途补发数据（调用方持有在途补发数据锁）
+     * @param sequence 存储序号
+     * @return 在途补发数据，不存在时为空
+     */
+    reissue_inflight_t *find_inflight(uint64_t sequence);
+
+    /**
+     * 移除连续已确认的在途补发数据并记录消费位置，由补发线程从存储中消费（调用方持有在途补发数据锁）
+     */
+    void retire_acked();
 
     /**
      * 登录
@@ -259,10 +499,11 @@ private:
 
     /**
      * 计算校验码
-     * @param data_unit 数据单元
+     * @param data 数据
+     * @param length 数据长度
      * @return 校验码
      */
-    uint8_t calculate_check_code(std::vector<uint8_t> data_unit);
+    uint8_t calculate_check_code(const uint8_t *data, size_t length);
 
     /**
      * 构造消息报文
@@ -272,6 +513,15 @@ private:
      */
     std::vector<uint8_t> build_message(command_flag_t command_flag, const std::vector<uint8_t> &data_unit);
 
+    /**
+     * 构造消息报文
+     * @param command_flag 命令标识
+     * @param data_unit 数据单元
+     * @param length 数据单元长度
+     * @return 消息报文
+     */
+    std::vector<uint8_t> build_message(command_flag_t command_flag, const uint8_t *data_unit, size_t length);
+
     /**
      * 双字节整形转数组（大端模式）
      * @param value 双字节整形数值
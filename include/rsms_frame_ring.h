@@ -0,0 +1,81 @@
+//
+// Created by hwyz_leo on 2025/9/6.
+//
+
+#ifndef RSMSAPP_RSMS_FRAME_RING_H
+#define RSMSAPP_RSMS_FRAME_RING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * 固定容量的数据帧环形缓冲
+ * 预先分配一块连续内存并按固定槽位大小划分，槽位大小取最大帧长度，追加时覆盖最早的帧，运行期间不再分配内存
+ * 每帧有从1开始递增的序号，读取时返回槽位内数据的地址，帧被覆盖前地址有效
+ */
+class RsmsFrameRing {
+public:
+    /**
+     * 构造函数
+     * @param slot_count 槽位数量
+     */
+    explicit RsmsFrameRing(size_t slot_count);
+
+    /**
+     * 按最大帧长度分配槽位，已缓存的帧保留
+     * @param slot_bytes 槽位大小
+     */
+    void reserve(size_t slot_bytes);
+
+    /**
+     * 追加帧，已满时覆盖最早的帧，帧长度超过槽位大小时重新分配槽位
+     * @param data 数据
+     * @param length 数据长度
+     * @return 帧序号
+     */
+    uint64_t push(const uint8_t *data, size_t length);
+
+    /**
+     * 读取帧
+     * @param sequence 帧序号
+     * @param out_data 数据地址
+     * @param out_length 数据长度
+     * @return 帧是否仍在缓冲中
+     */
+    bool get(uint64_t sequence, const uint8_t *&out_data, size_t &out_length) const;
+
+    /**
+     * 最早的帧序号
+     * @return 帧序号
+     */
+    uint64_t front_sequence() const;
+
+    /**
+     * 下一帧的序号
+     * @return 帧序号
+     */
+    uint64_t end_sequence() const;
+
+    /**
+     * 是否已满，已满时追加会覆盖最早的帧
+     * @return 是否已满
+     */
+    bool is_full() const;
+
+private:
+    // 槽位数量
+    size_t slot_count_;
+    // 槽位大小
+    size_t slot_bytes_ = 0;
+    // 槽位内存
+    std::vector<uint8_t> arena_;
+    // 各槽位的帧长度
+    std::vector<uint32_t> lengths_;
+    // 下一帧的序号
+    uint64_t next_sequence_ = 1;
+    // 缓存的帧数量
+    size_t count_ = 0;
+};
+
+#endif //RSMSAPP_RSMS_FRAME_RING_H
@@ -0,0 +1,94 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+
+#ifndef RSMSAPP_RSMS_LATENCY_HISTOGRAM_H
+#define RSMSAPP_RSMS_LATENCY_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * 时延直方图（HDR风格的对数线性分桶）
+ * 每个2的幂区间再均分为8个子桶，任意取值的相对误差不超过12.5%，内存占用固定，与记录数量无关
+ * 非线程安全，由调用方加锁
+ */
+class RsmsLatencyHistogram {
+public:
+    /**
+     * 构造函数
+     */
+    RsmsLatencyHistogram();
+
+public:
+    /**
+     * 记录一个取值
+     * @param value 取值
+     */
+    void record(uint64_t value);
+
+    /**
+     * 获取分位值
+     * @param quantile 分位（0-1）
+     * @return 分位值所在分桶的上界（不超过最大值），无记录时为0
+     */
+    uint64_t percentile(double quantile) const;
+
+    /**
+     * 获取记录数量
+     * @return 记录数量
+     */
+    uint64_t count() const;
+
+    /**
+     * 获取最小值
+     * @return 最小值，无记录时为0
+     */
+    uint64_t min() const;
+
+    /**
+     * 获取最大值
+     * @return 最大值
+     */
+    uint64_t max() const;
+
+    /**
+     * 获取平均值
+     * @return 平均值，无记录时为0
+     */
+    double mean() const;
+
+    /**
+     * 清空
+     */
+    void reset();
+
+private:
+    /**
+     * 计算取值所在分桶
+     * @param value 取值
+     * @return 分桶序号
+     */
+    static size_t bucket_index(uint64_t value);
+
+    /**
+     * 计算分桶上界
+     * @param index 分桶序号
+     * @return 上界
+     */
+    static uint64_t bucket_upper(size_t index);
+
+    // 各分桶记录数量
+    std::vector<uint64_t> counts_;
+    // 记录数量
+    uint64_t count_ = 0;
+    // 最小值
+    uint64_t min_ = 0;
+    // 最大值
+    uint64_t max_ = 0;
+    // 取值总和
+    double sum_ = 0;
+};
+
+#endif //RSMSAPP_RSMS_LATENCY_HISTOGRAM_H
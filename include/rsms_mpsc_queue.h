@@ -0,0 +1,132 @@
+//
+// Created by hwyz_leo on 2025/9/7.
+//
+
+#ifndef RSMSAPP_RSMS_MPSC_QUEUE_H
+#define RSMSAPP_RSMS_MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * 无锁多生产者单消费者队列
+ * 生产者通过一次CAS把节点（或预先串好的一批节点）挂到链表头，消费者通过一次交换取走整条链表再反转为先进先出顺序，
+ * 因此批量出队每批只需一次原子操作，消费者一次取走全部节点也不存在ABA问题
+ * @tparam T 元素类型
+ */
+template<typename T>
+class RsmsMpscQueue {
+public:
+    RsmsMpscQueue() = default;
+
+    /**
+     * 析构函数，释放未出队的节点
+     */
+    ~RsmsMpscQueue() {
+        node_t *node = head_.exchange(nullptr, std::memory_order_acquire);
+        while (node != nullptr) {
+            node_t *next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * 防止对象被复制
+     */
+    RsmsMpscQueue(const RsmsMpscQueue &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    RsmsMpscQueue &operator=(const RsmsMpscQueue &) = delete;
+
+public:
+    /**
+     * 入队
+     * @param value 元素
+     */
+    void push(T &&value) {
+        node_t *node = new node_t{std::move(value), nullptr};
+        link(node, node);
+    }
+
+    /**
+     * 批量入队，整批只需一次原子操作且保持顺序
+     * @param values 元素
+     */
+    void push_batch(std::vector<T> &&values) {
+        if (values.empty()) {
+            return;
+        }
+        // 链表头为最新的元素，按逆序串联
+        node_t *last = new node_t{std::move(values.front()), nullptr};
+        node_t *first = last;
+        for (size_t i = 1; i < values.size(); i++) {
+            first = new node_t{std::move(values[i]), first};
+        }
+        values.clear();
+        link(first, last);
+    }
+
+    /**
+     * 批量出队（仅消费者线程调用）
+     * @param out_values 按入队顺序追加的元素
+     * @return 出队数量
+     */
+    size_t pop_all(std::vector<T> &out_values) {
+        node_t *node = head_.exchange(nullptr, std::memory_order_acquire);
+        // 反转为入队顺序
+        node_t *reversed = nullptr;
+        while (node != nullptr) {
+            node_t *next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+        size_t count = 0;
+        while (reversed != nullptr) {
+            node_t *next = reversed->next;
+            out_values.push_back(std::move(reversed->value));
+            delete reversed;
+            reversed = next;
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * 是否为空
+     * @return 是否为空
+     */
+    bool empty() const {
+        return head_.load(std::memory_order_relaxed) == nullptr;
+    }
+
+private:
+    // 节点
+    struct node_t {
+        T value; // 元素
+        node_t *next; // 更早入队的节点
+    };
+
+    // 链表头，为最近入队的节点
+    std::atomic<node_t *> head_{nullptr};
+
+private:
+    /**
+     * 把已串联的节点挂到链表头
+     * @param first 最新的节点
+     * @param last 最早的节点
+     */
+    void link(node_t *first, node_t *last) {
+        last->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(last->next, first, std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        }
+    }
+};
+
+#endif //RSMSAPP_RSMS_MPSC_QUEUE_H
@@ -0,0 +1,104 @@
+//
+// Created by hwyz_leo on 2025/9/1.
+//
+
+#ifndef RSMSAPP_RSMS_RATE_CONTROLLER_H
+#define RSMSAPP_RSMS_RATE_CONTROLLER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * 补发速率控制
+ * 令牌桶按当前速率发放令牌，速率按AIMD调整：每个控制周期内确认时延、实时数据确认时延均正常且在途未满时加性增加，
+ * 出现确认超时、连接断开或时延超过目标时乘性减小，速率限制在下限与上限之间
+ * 非线程安全，由调用方加锁
+ */
+class RsmsRateController {
+public:
+    // 时钟
+    typedef std::chrono::steady_clock clock_t;
+
+    /**
+     * 构造函数
+     * @param floor 速率下限（条/秒）
+     * @param ceiling 速率上限（条/秒）
+     * @param step 每个控制周期的加性增量（条/秒）
+     * @param target_latency_ms 目标确认时延
+     */
+    RsmsRateController(double floor, double ceiling, double step, int target_latency_ms);
+
+public:
+    /**
+     * 获取令牌
+     * @param now 当前时间
+     * @param max_count 最多获取数量
+     * @return 获取的令牌数量
+     */
+    size_t acquire(clock_t::time_point now, size_t max_count);
+
+    /**
+     * 按控制周期调整速率
+     * @param now 当前时间
+     * @param is_window_full 在途窗口是否已满
+     */
+    void update(clock_t::time_point now, bool is_window_full);
+
+    /**
+     * 补发数据确认
+     * @param latency 确认时延
+     */
+    void on_ack(clock_t::duration latency);
+
+    /**
+     * 实时数据确认
+     * @param latency 确认时延
+     */
+    void on_realtime_ack(clock_t::duration latency);
+
+    /**
+     * 发生拥塞（确认超时、连接断开）
+     */
+    void on_congestion();
+
+    /**
+     * 当前速率
+     * @return 速率（条/秒）
+     */
+    double get_rate() const;
+
+    /**
+     * 下一个令牌的等待时间
+     * @return 等待时间
+     */
+    std::chrono::milliseconds next_token_wait() const;
+
+private:
+    // 速率下限
+    double floor_;
+    // 速率上限
+    double ceiling_;
+    // 加性增量
+    double step_;
+    // 目标确认时延
+    double target_latency_ms_;
+    // 当前速率
+    double rate_;
+    // 令牌数量
+    double tokens_ = 0;
+    // 上次发放令牌时间
+    clock_t::time_point last_refill_time_;
+    // 上次调整速率时间
+    clock_t::time_point last_update_time_;
+    // 补发确认时延（指数平均）
+    double latency_ms_ = 0;
+    // 本周期确认数量
+    uint32_t ack_count_ = 0;
+    // 本周期实时数据最大确认时延
+    double realtime_latency_ms_ = 0;
+    // 本周期是否发生拥塞
+    bool is_congested_ = false;
+};
+
+#endif //RSMSAPP_RSMS_RATE_CONTROLLER_H
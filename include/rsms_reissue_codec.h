@@ -0,0 +1,172 @@
+//
+// Created by hwyz_leo on 2025/9/4.
+//
+
+#ifndef RSMSAPP_RSMS_REISSUE_CODEC_H
+#define RSMSAPP_RSMS_REISSUE_CODEC_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "rsms_reissue_store.h"
+
+/**
+ * 压缩的补发数据存储
+ * 包装其他补发数据存储，相邻的实时数据通常只有时间、车速、电流等少量字节不同，
+ * 因此除关键帧外每条数据只保存与上一条数据异或后的游程编码，读取时从最近的关键帧开始解码
+ * 关键帧至少每隔指定条数出现一次，长度变化或编码后不更小时也写入关键帧
+ * 已消费的数据只有在下一个关键帧之前的部分才从底层存储中移除，保证未消费的数据始终可以解码
+ */
+class RsmsReissueCodec : public RsmsReissueStore {
+public:
+    /**
+     * 构造函数
+     * @param store 底层存储
+     * @param keyframe_interval 关键帧最大间隔条数
+     */
+    RsmsReissueCodec(std::unique_ptr<RsmsReissueStore> store, size_t keyframe_interval);
+
+    /**
+     * 防止对象被复制
+     */
+    RsmsReissueCodec(const RsmsReissueCodec &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    RsmsReissueCodec &operator=(const RsmsReissueCodec &) = delete;
+
+public:
+    /**
+     * 打开底层存储
+     * @return 是否打开成功
+     */
+    bool open() override;
+
+    /**
+     * 关闭底层存储并输出压缩率
+     */
+    void close() override;
+
+    /**
+     * 编码后追加数据
+     * @param data 数据
+     * @param length 数据长度
+     * @return 是否追加成功
+     */
+    bool append(const uint8_t *data, size_t length) override;
+
+    /**
+     * 按追加顺序读取并解码数据，不移除
+     * @param sequence 起始序号，早于最早未消费数据时从最早未消费数据开始
+     * @param max_count 最多读取数量
+     * @param out_frames 解码后的数据
+     * @param out_sequence 实际读取的第一条数据的序号，关键帧已被淘汰而无法解码的数据会被跳过
+     * @return 读取数量
+     */
+    size_t peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                uint64_t &out_sequence) override;
+
+    /**
+     * 消费序号小于指定序号的数据，底层存储保留到不晚于指定序号的最近关键帧
+     * @param end_sequence 结束序号（不含）
+     */
+    void consume(uint64_t end_sequence) override;
+
+    /**
+     * 最早未消费数据的序号
+     * @return 序号
+     */
+    uint64_t head_sequence() override;
+
+    /**
+     * 落盘
+     * @return 是否成功
+     */
+    bool sync() override;
+
+    /**
+     * 未消费的数据数量
+     * @return 数据数量
+     */
+    size_t size() override;
+
+    /**
+     * 压缩率（原始字节数/存储字节数）
+     * @return 压缩率，未写入数据时为1
+     */
+    double get_compression_ratio() const;
+
+    /**
+     * 编码数据
+     * @param previous 上一条数据，为空时编码为关键帧
+     * @param data 数据
+     * @param length 数据长度
+     * @param out_record 编码后的记录
+     * @return 是否编码为差分帧
+     */
+    static bool encode(const std::vector<uint8_t> &previous, const uint8_t *data, size_t length,
+                       std::vector<uint8_t> &out_record);
+
+    /**
+     * 解码数据
+     * @param previous 上一条数据，关键帧时忽略
+     * @param record 记录
+     * @param out_data 解码后的数据
+     * @return 是否解码成功，差分帧缺少上一条数据时失败
+     */
+    static bool decode(const std::vector<uint8_t> *previous, const std::vector<uint8_t> &record,
+                       std::vector<uint8_t> &out_data);
+
+    /**
+     * 是否为关键帧
+     * @param record 记录
+     * @return 是否为关键帧
+     */
+    static bool is_keyframe(const std::vector<uint8_t> &record);
+
+private:
+    // 底层存储
+    std::unique_ptr<RsmsReissueStore> store_;
+    // 关键帧最大间隔条数
+    size_t keyframe_interval_;
+    // 编解码锁
+    std::mutex mutex_;
+    // 上一条写入的数据，为空时下一条写入关键帧
+    std::vector<uint8_t> last_frame_;
+    // 距上一个关键帧的条数
+    size_t frames_since_keyframe_ = 0;
+    // 已知的关键帧序号
+    std::set<uint64_t> keyframes_;
+    // 最早未消费数据的序号，底层存储可能保留更早的数据用于解码
+    uint64_t head_sequence_ = 0;
+    // 最近一次解码的数据序号
+    uint64_t cached_sequence_ = 0;
+    // 最近一次解码的数据，为空时无缓存
+    std::vector<uint8_t> cached_frame_;
+    // 累计原始字节数
+    std::atomic<uint64_t> raw_bytes_{0};
+    // 累计存储字节数
+    std::atomic<uint64_t> stored_bytes_{0};
+
+private:
+    /**
+     * 从底层存储读取并解码（调用方持有锁）
+     * @param start 底层存储读取起始序号
+     * @param previous 起始序号前一条数据，为空时从关键帧开始解码
+     * @param sequence 需要输出的起始序号
+     * @param max_count 最多输出数量
+     * @param out_frames 解码后的数据
+     * @param out_sequence 实际输出的第一条数据的序号
+     * @return 输出数量
+     */
+    size_t decode_range(uint64_t start, const std::vector<uint8_t> *previous, uint64_t sequence, size_t max_count,
+                        std::vector<std::vector<uint8_t>> &out_frames, uint64_t &out_sequence);
+};
+
+#endif //RSMSAPP_RSMS_REISSUE_CODEC_H
@@ -0,0 +1,52 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+
+#ifndef RSMSAPP_RSMS_REISSUE_ENVELOPE_H
+#define RSMSAPP_RSMS_REISSUE_ENVELOPE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * 补发信封：多条完整的国标报文合并为一次发布，减少每条报文的MQTT与TLS记录开销
+ * 格式（多字节整数为大端序）：
+ *   0-1  魔数 0x52 0x42（"RB"）
+ *   2    版本 0x01
+ *   3    压缩方式，见envelope_compression_t
+ *   4-5  报文数量
+ *   6-9  报文区压缩前长度
+ *   10-13 报文区压缩前的CRC32
+ *   14-  报文区，压缩方式非0时为压缩后的数据；压缩前为重复的[4字节报文长度][报文]
+ * 解包见tools/rsms_envelope_unpack.cpp
+ */
+
+// 信封报文区压缩方式
+enum envelope_compression_t {
+    ENVELOPE_COMPRESSION_NONE = 0, // 不压缩
+    ENVELOPE_COMPRESSION_LZ4 = 1, // LZ4块格式
+};
+
+// 信封头长度
+const size_t kEnvelopeHeaderLength = 14;
+
+/**
+ * 打包补发信封，压缩后不小于原数据时不压缩
+ * @param frames 国标报文
+ * @param compression 压缩方式
+ * @param out 信封，覆盖已有内容
+ */
+void pack_reissue_envelope(const std::vector<std::vector<uint8_t>> &frames, envelope_compression_t compression,
+                           std::vector<uint8_t> &out);
+
+/**
+ * 解包补发信封
+ * @param data 信封
+ * @param length 信封长度
+ * @param frames 国标报文，追加在已有内容之后，解包失败时不追加
+ * @return 是否解包成功
+ */
+bool unpack_reissue_envelope(const uint8_t *data, size_t length, std::vector<std::vector<uint8_t>> &frames);
+
+#endif //RSMSAPP_RSMS_REISSUE_ENVELOPE_H
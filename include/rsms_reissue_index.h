@@ -0,0 +1,172 @@
+//
+// Created by hwyz_leo on 2025/9/5.
+//
+
+#ifndef RSMSAPP_RSMS_REISSUE_INDEX_H
+#define RSMSAPP_RSMS_REISSUE_INDEX_H
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rsms_reissue_store.h"
+
+/**
+ * 带时间索引的补发数据存储
+ * 包装其他补发数据存储，按数据单元中的采集时间维护稀疏索引（采集时间 -> 序号），每隔指定秒数记录一条，
+ * 索引按时间递增，时间回退的数据不记录索引，按时间定位时二分查找后最多多读一个索引间隔的数据
+ * 索引追加写入单独的文件，只作为定位提示，丢失或与数据不一致时重新打开会丢弃失效的索引
+ */
+class RsmsReissueIndex : public RsmsReissueStore {
+public:
+    /**
+     * 构造函数
+     * @param store 底层存储
+     * @param file_path 索引文件路径
+     * @param interval_second 索引间隔秒数
+     */
+    RsmsReissueIndex(std::unique_ptr<RsmsReissueStore> store, std::string file_path, int interval_second);
+
+    /**
+     * 防止对象被复制
+     */
+    RsmsReissueIndex(const RsmsReissueIndex &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    RsmsReissueIndex &operator=(const RsmsReissueIndex &) = delete;
+
+public:
+    /**
+     * 打开底层存储并加载索引，丢弃已消费或超出数据范围的索引
+     * @return 是否打开成功
+     */
+    bool open() override;
+
+    /**
+     * 关闭底层存储与索引文件
+     */
+    void close() override;
+
+    /**
+     * 追加数据，距上条索引超过索引间隔时记录索引
+     * @param data 数据
+     * @param length 数据长度
+     * @return 是否追加成功
+     */
+    bool append(const uint8_t *data, size_t length) override;
+
+    /**
+     * 按追加顺序读取数据，不移除
+     * @param sequence 起始序号，早于最早未消费数据时从最早未消费数据开始
+     * @param max_count 最多读取数量
+     * @param out_frames 读取的数据
+     * @param out_sequence 实际读取的第一条数据的序号
+     * @return 读取数量
+     */
+    size_t peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                uint64_t &out_sequence) override;
+
+    /**
+     * 消费序号小于指定序号的数据并移除对应索引
+     * @param end_sequence 结束序号（不含）
+     */
+    void consume(uint64_t end_sequence) override;
+
+    /**
+     * 最早未消费数据的序号
+     * @return 序号
+     */
+    uint64_t head_sequence() override;
+
+    /**
+     * 落盘
+     * @return 是否成功
+     */
+    bool sync() override;
+
+    /**
+     * 未消费的数据数量
+     * @return 数据数量
+     */
+    size_t size() override;
+
+    /**
+     * 按采集时间定位起始序号，该序号之前的数据采集时间均早于指定时间
+     * @param timestamp 采集时间（秒）
+     * @return 序号
+     */
+    uint64_t seek(long long timestamp);
+
+    /**
+     * 按采集时间定位结束序号（不含），该序号及之后的数据采集时间均晚于指定时间
+     * @param timestamp 采集时间（秒）
+     * @return 序号
+     */
+    uint64_t seek_end(long long timestamp);
+
+    /**
+     * 消费采集时间早于指定时间的数据，只按索引定位，不读取数据
+     * @param timestamp 采集时间（秒）
+     * @return 消费的数据数量
+     */
+    size_t trim(long long timestamp);
+
+    /**
+     * 解析数据单元中的采集时间
+     * @param data 数据单元
+     * @param length 数据单元长度
+     * @return 采集时间（秒），解析失败时为-1
+     */
+    static long long get_frame_time(const uint8_t *data, size_t length);
+
+private:
+    // 索引
+    struct index_entry_t {
+        int64_t timestamp; // 采集时间
+        uint64_t sequence; // 序号
+    };
+
+    // 底层存储
+    std::unique_ptr<RsmsReissueStore> store_;
+    // 索引文件路径
+    std::string file_path_;
+    // 索引间隔秒数
+    int interval_second_;
+    // 索引锁
+    std::mutex mutex_;
+    // 索引文件描述符
+    int fd_ = -1;
+    // 未消费数据的索引
+    std::deque<index_entry_t> entries_;
+    // 索引文件中已失效的索引数量，超过有效索引数量时重写索引文件
+    size_t stale_count_ = 0;
+    // 最近一条索引的采集时间
+    long long last_index_timestamp_ = -1;
+
+private:
+    /**
+     * 二分查找第一条采集时间晚于指定时间的索引（调用方持有锁）
+     * @param timestamp 采集时间
+     * @return 索引位置
+     */
+    size_t upper_bound(long long timestamp) const;
+
+    /**
+     * 移除序号小于最早未消费数据序号的索引，失效索引过多时重写索引文件（调用方持有锁）
+     */
+    void drop_consumed();
+
+    /**
+     * 重写索引文件（调用方持有锁）
+     * @return 是否成功
+     */
+    bool rewrite();
+};
+
+#endif //RSMSAPP_RSMS_REISSUE_INDEX_H
@@ -0,0 +1,235 @@
+//
+// Created by hwyz_leo on 2025/8/30.
+//
+
+#ifndef RSMSAPP_RSMS_REISSUE_RING_H
+#define RSMSAPP_RSMS_REISSUE_RING_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "rsms_reissue_store.h"
+
+/**
+ * 固定大小的环形补发数据存储
+ * 文件按配置大小预先分配并通过mmap映射，前两个扇区为交替写入的元数据（读指针与序号），其余为数据区
+ * 每条记录为：记录头（魔数、长度、序号、CRC32）+ 数据，按8字节对齐连续写入，空间不足时淘汰最早的记录
+ * 追加只写映射内存并记录脏范围，由后台线程定时把脏范围扩展到扇区边界后落盘，剩余空间不足时提前淘汰并落盘读指针，
+ * 追加时只在将要覆盖读指针尚未落盘的空间时同步写入元数据扇区，掉电恢复时从读指针开始按序号连续扫描即可得到首尾位置
+ * 内存中每隔固定数量的序号保存一条记录偏移，按序号读取时二分查找后最多跳过一个间隔的记录
+ */
+class RsmsReissueRing : public RsmsReissueStore {
+public:
+    /**
+     * 构造函数
+     * @param file_path 存储文件路径
+     * @param capacity_bytes 存储文件大小
+     * @param sync_interval_ms 定时落盘间隔
+     */
+    RsmsReissueRing(std::string file_path, size_t capacity_bytes, int sync_interval_ms);
+
+    /**
+     * 析构函数
+     */
+    ~RsmsReissueRing() override;
+
+    /**
+     * 防止对象被复制
+     */
+    RsmsReissueRing(const RsmsReissueRing &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    RsmsReissueRing &operator=(const RsmsReissueRing &) = delete;
+
+public:
+    /**
+     * 打开存储，扫描恢复首尾位置
+     * @return 是否打开成功
+     */
+    bool open() override;
+
+    /**
+     * 关闭存储，落盘数据与元数据
+     */
+    void close() override;
+
+    /**
+     * 追加记录，空间不足时淘汰最早的记录
+     * @param data 数据
+     * @param length 数据长度
+     * @return 是否追加成功
+     */
+    bool append(const uint8_t *data, size_t length) override;
+
+    /**
+     * 按追加顺序读取记录，不移除
+     * @param sequence 起始序号，早于最早未消费记录时从最早未消费记录开始
+     * @param max_count 最多读取数量
+     * @param out_frames 读取的记录
+     * @param out_sequence 实际读取的第一条记录的序号
+     * @return 读取数量
+     */
+    size_t peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                uint64_t &out_sequence) override;
+
+    /**
+     * 消费序号小于指定序号的记录，推进读指针
+     * @param end_sequence 结束序号（不含）
+     */
+    void consume(uint64_t end_sequence) override;
+
+    /**
+     * 最早未消费记录的序号
+     * @return 序号
+     */
+    uint64_t head_sequence() override;
+
+    /**
+     * 落盘数据与元数据
+     * @return 是否成功
+     */
+    bool sync() override;
+
+    /**
+     * 未消费的记录数量
+     * @return 记录数量
+     */
+    size_t size() override;
+
+private:
+    // 存储文件路径
+    std::string file_path_;
+    // 存储文件大小
+    size_t capacity_bytes_;
+    // 定时落盘间隔
+    int sync_interval_ms_;
+    // 扇区大小
+    size_t sector_bytes_ = 4096;
+    // 存储锁
+    std::mutex mutex_;
+    // 落盘锁，保证同一时间只有一次落盘
+    std::mutex sync_mutex_;
+    // 落盘条件
+    std::condition_variable cv_sync_;
+    // 是否打开
+    std::atomic_bool is_opened_{false};
+    // 落盘线程
+    std::thread sync_thread_;
+    // 文件描述符
+    int fd_ = -1;
+    // 映射地址
+    uint8_t *base_ = nullptr;
+    // 数据区起始偏移
+    uint64_t data_begin_ = 0;
+    // 数据区结束偏移
+    uint64_t data_end_ = 0;
+    // 最早未消费记录的偏移
+    uint64_t head_offset_ = 0;
+    // 最早未消费记录的序号
+    uint64_t head_sequence_ = 0;
+    // 下一条记录的写入偏移
+    uint64_t tail_offset_ = 0;
+    // 下一条记录的序号
+    uint64_t tail_sequence_ = 0;
+    // 未消费的记录数量
+    size_t count_ = 0;
+    // 未消费的记录占用字节数（含回绕填充）
+    uint64_t used_bytes_ = 0;
+    // 已消费但读指针尚未落盘的字节数，这部分空间写入前需先落盘元数据
+    uint64_t lagging_bytes_ = 0;
+    // 数据区未落盘的范围（起始偏移，结束偏移），按写入顺序，回绕时新开一段
+    std::vector<std::pair<uint64_t, uint64_t>> dirty_ranges_;
+    // 元数据是否有未落盘的变化
+    bool is_meta_dirty_ = false;
+    // 元数据代数，用于选择较新的元数据扇区
+    uint64_t meta_generation_ = 0;
+    // 累计淘汰的记录数量
+    uint64_t evicted_count_ = 0;
+    // 记录位置
+    struct position_t {
+        uint64_t sequence; // 序号
+        uint64_t offset; // 偏移
+    };
+    // 未消费记录的稀疏位置，按序号递增
+    std::deque<position_t> positions_;
+
+private:
+    /**
+     * 校验指定偏移处的记录
+     * @param offset 偏移
+     * @param sequence 期望序号
+     * @param out_next 下一条记录的偏移
+     * @return 是否为有效记录
+     */
+    bool check_record(uint64_t offset, uint64_t sequence, uint64_t &out_next) const;
+
+    /**
+     * 按间隔记录位置（调用方持有锁）
+     * @param sequence 序号
+     * @param offset 记录偏移
+     */
+    void add_position(uint64_t sequence, uint64_t offset);
+
+    /**
+     * 记录数据区未落盘的范围（调用方持有锁）
+     * @param begin 起始偏移
+     * @param end 结束偏移
+     */
+    void mark_dirty(uint64_t begin, uint64_t end);
+
+    /**
+     * 淘汰最早的记录直到剩余空间不少于指定字节数（调用方持有锁）
+     * @param free_bytes 剩余空间字节数
+     * @return 淘汰的记录数量
+     */
+    size_t evict(uint64_t free_bytes);
+
+    /**
+     * 移除最早的记录
+     * @return 释放的字节数
+     */
+    uint64_t pop_head();
+
+    /**
+     * 指定偏移处是否回绕到数据区起始位置
+     * @param offset 偏移
+     * @param sequence 下一条记录的序号
+     * @return 是否回绕
+     */
+    bool is_wrap(uint64_t offset, uint64_t sequence) const;
+
+    /**
+     * 加载元数据
+     * @return 是否存在有效元数据
+     */
+    bool load_meta();
+
+    /**
+     * 写入元数据并只落盘所在的元数据扇区（调用方持有锁）
+     * @return 是否成功
+     */
+    bool save_meta();
+
+    /**
+     * 落盘数据与元数据
+     * @return 是否成功
+     */
+    bool flush();
+
+    /**
+     * 定时落盘的线程函数
+     */
+    void sync_thread();
+};
+
+#endif //RSMSAPP_RSMS_REISSUE_RING_H
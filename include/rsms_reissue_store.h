@@ -0,0 +1,75 @@
+//
+// Created by hwyz_leo on 2025/8/30.
+//
+
+#ifndef RSMSAPP_RSMS_REISSUE_STORE_H
+#define RSMSAPP_RSMS_REISSUE_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * 补发数据存储
+ * 按追加顺序保存补发数据单元，每条数据有递增的序号，读取时不移除，补发完成后再按序号消费
+ */
+class RsmsReissueStore {
+public:
+    /**
+     * 打开存储，恢复掉电前未消费的数据
+     * @return 是否打开成功
+     */
+    virtual bool open() = 0;
+
+    /**
+     * 关闭存储
+     */
+    virtual void close() = 0;
+
+    /**
+     * 追加数据
+     * @param data 数据
+     * @param length 数据长度
+     * @return 是否追加成功
+     */
+    virtual bool append(const uint8_t *data, size_t length) = 0;
+
+    /**
+     * 按追加顺序读取数据，不移除
+     * @param sequence 起始序号，早于最早未消费数据时从最早未消费数据开始
+     * @param max_count 最多读取数量
+     * @param out_frames 读取的数据
+     * @param out_sequence 实际读取的第一条数据的序号
+     * @return 读取数量
+     */
+    virtual size_t peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                        uint64_t &out_sequence) = 0;
+
+    /**
+     * 消费序号小于指定序号的数据
+     * @param end_sequence 结束序号（不含）
+     */
+    virtual void consume(uint64_t end_sequence) = 0;
+
+    /**
+     * 最早未消费数据的序号，数据被消费或淘汰后递增
+     * @return 序号
+     */
+    virtual uint64_t head_sequence() = 0;
+
+    /**
+     * 落盘
+     * @return 是否成功
+     */
+    virtual bool sync() = 0;
+
+    /**
+     * 未消费的数据数量
+     * @return 数据数量
+     */
+    virtual size_t size() = 0;
+
+    virtual ~RsmsReissueStore() = default;
+};
+
+#endif //RSMSAPP_RSMS_REISSUE_STORE_H
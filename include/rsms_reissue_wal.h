@@ -0,0 +1,272 @@
+//
+// Created by hwyz_leo on 2025/8/29.
+//
+
+#ifndef RSMSAPP_RSMS_REISSUE_WAL_H
+#define RSMSAPP_RSMS_REISSUE_WAL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rsms_reissue_store.h"
+
+/**
+ * 补发数据预写日志
+ * 按段追加写入，每条记录为：长度（4字节）+ CRC32（4字节）+ 数据，由后台线程批量fsync
+ * 读游标与最早未消费记录的序号持久化在cursor文件中，已消费完的段在读游标落盘后才删除
+ * 切换写入段时在.seq文件中记录新段第一条记录的序号，启动时只扫描读游标所在段与最后一段，
+ * 中间段的记录数量由相邻段的序号得出，启动耗时与内存不随积压数据量增长
+ * 内存中只保存读取位置附近几个段的记录结束位置，由预读线程提前加载下一段，读取时从段文件中读出
+ */
+class RsmsReissueWal : public RsmsReissueStore {
+public:
+    /**
+     * 构造函数
+     * @param dir_path 日志目录
+     * @param segment_bytes 单段大小上限
+     * @param sync_interval_ms 批量fsync间隔
+     */
+    RsmsReissueWal(std::string dir_path, size_t segment_bytes, int sync_interval_ms);
+
+    /**
+     * 析构函数
+     */
+    ~RsmsReissueWal() override;
+
+    /**
+     * 防止对象被复制
+     */
+    RsmsReissueWal(const RsmsReissueWal &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    RsmsReissueWal &operator=(const RsmsReissueWal &) = delete;
+
+public:
+    /**
+     * 打开日志，校验并截断末尾不完整的记录
+     * @return 是否打开成功
+     */
+    bool open() override;
+
+    /**
+     * 关闭日志，落盘数据与读游标
+     */
+    void close() override;
+
+    /**
+     * 追加记录，数据由后台线程批量落盘
+     * @param data 数据
+     * @param length 数据长度
+     * @return 是否追加成功
+     */
+    bool append(const uint8_t *data, size_t length) override;
+
+    /**
+     * 按追加顺序读取记录，不移除
+     * @param sequence 起始序号，早于最早未消费记录时从最早未消费记录开始
+     * @param max_count 最多读取数量
+     * @param out_frames 读取的记录
+     * @param out_sequence 实际读取的第一条记录的序号
+     * @return 读取数量
+     */
+    size_t peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                uint64_t &out_sequence) override;
+
+    /**
+     * 消费序号小于指定序号的记录，推进读游标
+     * @param end_sequence 结束序号（不含）
+     */
+    void consume(uint64_t end_sequence) override;
+
+    /**
+     * 最早未消费记录的序号
+     * @return 序号
+     */
+    uint64_t head_sequence() override;
+
+    /**
+     * 落盘数据与读游标
+     * @return 是否成功
+     */
+    bool sync() override;
+
+    /**
+     * 未消费的记录数量
+     * @return 记录数量
+     */
+    size_t size() override;
+
+private:
+    // 记录位置
+    struct position_t {
+        uint64_t segment; // 段号
+        uint64_t offset; // 段内偏移
+    };
+
+    // 日志目录
+    std::string dir_path_;
+    // 单段大小上限
+    size_t segment_bytes_;
+    // 批量fsync间隔
+    int sync_interval_ms_;
+    // 日志锁
+    std::mutex mutex_;
+    // 落盘锁，保证同一时间只有一次落盘
+    std::mutex sync_mutex_;
+    // 落盘条件
+    std::condition_variable cv_sync_;
+    // 是否打开
+    std::atomic_bool is_opened_{false};
+    // 落盘线程
+    std::thread sync_thread_;
+    // 当前写入段号
+    uint64_t write_segment_ = 0;
+    // 当前写入段文件描述符
+    int write_fd_ = -1;
+    // 当前写入段大小
+    uint64_t write_offset_ = 0;
+    // 当前读取段号
+    uint64_t read_segment_ = 0;
+    // 当前读取段文件描述符
+    int read_fd_ = -1;
+    // 是否有未落盘的数据
+    bool is_data_dirty_ = false;
+    // 读游标
+    position_t cursor_{0, 0};
+    // 读游标是否有未持久化的变化
+    bool is_cursor_dirty_ = false;
+    // 段信息
+    struct segment_t {
+        uint64_t segment; // 段号
+        uint64_t begin_offset; // 第一条未消费记录的偏移，读游标所在段之外为0
+        uint64_t first_sequence; // 第一条未消费记录的序号
+        size_t count; // 未消费记录数量
+        bool is_loaded; // 记录结束位置是否已加载
+        std::deque<uint32_t> ends; // 未消费记录的结束位置，未加载时为空
+    };
+    // 未消费的段，最后一段为写入段且始终已加载
+    std::deque<segment_t> segments_;
+    // 最早未消费记录的序号
+    uint64_t head_sequence_ = 1;
+    // 已消费完待删除的最小段号，访问时持有落盘锁
+    uint64_t first_segment_ = 0;
+    // 最近读取的记录序号，预读线程据此加载后续段
+    uint64_t read_sequence_ = 0;
+    // 预读条件
+    std::condition_variable cv_prefetch_;
+    // 预读线程
+    std::thread prefetch_thread_;
+
+private:
+    /**
+     * 段文件路径
+     * @param segment 段号
+     * @return 文件路径
+     */
+    std::string segment_path(uint64_t segment) const;
+
+    /**
+     * 段序号文件路径
+     * @param segment 段号
+     * @return 文件路径
+     */
+    std::string sequence_path(uint64_t segment) const;
+
+    /**
+     * 游标文件路径
+     * @return 文件路径
+     */
+    std::string cursor_path() const;
+
+    /**
+     * 先写临时文件并落盘再重命名
+     * @param path 文件路径
+     * @param content 文件内容
+     * @return 是否成功
+     */
+    static bool save_file(const std::string &path, const std::string &content);
+
+    /**
+     * 加载段第一条记录的序号
+     * @param segment 段号
+     * @param out_sequence 序号
+     * @return 是否存在有效的段序号文件
+     */
+    bool load_segment_sequence(uint64_t segment, uint64_t &out_sequence) const;
+
+    /**
+     * 扫描段文件中的记录，遇到不完整或校验失败的记录时停止
+     * @param segment 段号
+     * @param begin_offset 起始偏移
+     * @param out_ends 记录结束位置
+     * @return 最后一条有效记录的结束位置
+     */
+    uint64_t scan_segment(uint64_t segment, uint64_t begin_offset, std::deque<uint32_t> &out_ends) const;
+
+    /**
+     * 设置段的记录结束位置，与记录数量不一致时以扫描结果为准并调整后续段的序号（调用方持有锁）
+     * @param index 段位置
+     * @param ends 记录结束位置
+     */
+    void install_ends(size_t index, std::deque<uint32_t> &&ends);
+
+    /**
+     * 查找包含指定序号的段（调用方持有锁）
+     * @param sequence 序号
+     * @return 段位置，不存在时为段数量
+     */
+    size_t find_segment(uint64_t sequence) const;
+
+    /**
+     * 加载读游标与最早未消费记录的序号
+     */
+    void load_cursor();
+
+    /**
+     * 持久化读游标，先写临时文件再重命名
+     * @param cursor 读游标
+     * @param sequence 读游标处记录的序号
+     * @return 是否成功
+     */
+    bool save_cursor(const position_t &cursor, uint64_t sequence);
+
+    /**
+     * 打开新的写入段
+     * @param segment 段号
+     * @return 是否成功
+     */
+    bool open_segment(uint64_t segment);
+
+    /**
+     * 删除已落盘的读游标所在段之前的段（调用方持有落盘锁）
+     * @param end_segment 已落盘的读游标所在段号
+     */
+    void remove_consumed_segments(uint64_t end_segment);
+
+    /**
+     * 落盘数据与读游标
+     * @return 是否成功
+     */
+    bool flush();
+
+    /**
+     * 定时落盘的线程函数
+     */
+    void sync_thread();
+
+    /**
+     * 预读的线程函数，加载读取位置之后的段并释放较远段的记录结束位置
+     */
+    void prefetch_thread();
+};
+
+#endif //RSMSAPP_RSMS_REISSUE_WAL_H
@@ -11,6 +11,7 @@
 #include <chrono>
 #include <atomic>
 #include <fstream>
+#include <mutex>
 
 // 信号类型
 enum signal_t {
@@ -106,6 +107,25 @@ enum signal_t {
     SIGNAL_BATTERY1_PROBE15_TEMPERATURE = 815, // 电池子系统1温度探针15温度
 };
 
+// 信号数据类型
+enum signal_type_t {
+    SIGNAL_TYPE_BOOLEAN = 0, // 布尔值
+    SIGNAL_TYPE_BYTE = 1, // 无符号单字节整形
+    SIGNAL_TYPE_WORD = 2, // 无符号双字节整形
+    SIGNAL_TYPE_DWORD = 4, // 无符号四字节整形
+};
+
+// 信号定义
+struct signal_define_t {
+    signal_t key; // 信号类型
+    signal_type_t type; // 信号数据类型
+};
+
+// 信号定义表，MCU增量协议按表中下标编码信号存在位图，只允许在末尾追加
+extern const signal_define_t kSignalDefines[];
+// 信号定义表长度
+extern const size_t kSignalDefineCount;
+
 /**
  * 国标信号缓存
  */
@@ -225,9 +245,20 @@ public:
      */
     bool get_boolean(const int &key, bool &out_value);
 
+    /**
+     * 按信号数据类型设置数值
+     * @param key 缓存Key
+     * @param type 信号数据类型
+     * @param value 缓存值
+     * @return 是否成功
+     */
+    bool set_value(const int &key, const signal_type_t &type, const uint32_t &value);
+
 private:
     // 信号缓存数据
     std::unordered_map<int, std::string> signal_map_;
+    // 信号缓存锁（MQTT、CAN采集线程写入，采集线程读取）
+    std::mutex signal_mutex_;
     // 实例运行状态
     std::atomic<bool> is_running_{false};
     // 写入文件的线程
@@ -0,0 +1,249 @@
+//
+// Created by hwyz_leo on 2025/9/2.
+//
+
+#ifndef RSMSAPP_RSMS_UPLINK_SCHEDULER_H
+#define RSMSAPP_RSMS_UPLINK_SCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "yaml-cpp/yaml.h"
+
+#include "mqtt_publish_listener.h"
+
+// 上行消息优先级，数值越小优先级越高
+enum uplink_class_t {
+    UPLINK_CLASS_CONTROL = 0, // 车辆登录登出
+    UPLINK_CLASS_ALARM = 1, // 三级报警数据
+    UPLINK_CLASS_REALTIME = 2, // 实时信息上报
+    UPLINK_CLASS_REISSUE = 3, // 补发信息上报
+    UPLINK_CLASS_COUNT = 4,
+};
+
+// 上行消息统计
+struct uplink_metrics_t {
+    size_t depth; // 队列深度
+    uint64_t enqueued; // 入队数量
+    uint64_t sent; // 发送数量
+    uint64_t failed; // 发送失败或队列满丢弃数量
+    double avg_wait_ms; // 平均排队时间
+    double max_wait_ms; // 最大排队时间
+};
+
+/**
+ * 上行消息监听器
+ */
+class RsmsUplinkListener {
+public:
+    /**
+     * 消息已发送或发送失败
+     * @param type 优先级
+     * @param tag 提交时的标识
+     * @param is_success 是否发送成功
+     */
+    virtual void on_uplink_sent(uplink_class_t type, uint64_t tag, bool is_success) = 0;
+
+    /**
+     * 消息已确认
+     * @param type 优先级
+     * @param tag 提交时的标识
+     * @param latency 发送到确认的时延
+     */
+    virtual void on_uplink_ack(uplink_class_t type, uint64_t tag, std::chrono::steady_clock::duration latency) = 0;
+
+    /**
+     * 连接断开，已发送未确认的消息不会再收到确认
+     */
+    virtual void on_uplink_lost() = 0;
+
+    virtual ~RsmsUplinkListener() = default;
+};
+
+/**
+ * 上行消息调度
+ * 所有国标消息经由单一发送线程按优先级发送：登录登出 > 三级报警数据 > 实时信息 > 补发信息，
+ * 同时为补发信息保留一定的发送份额，避免高优先级消息持续存在时补发饿死
+ */
+class RsmsUplinkScheduler : public MqttPublishListener {
+public:
+    /**
+     * 析构虚函数
+     */
+    ~RsmsUplinkScheduler() override = default;
+
+    /**
+     * 防止对象被复制
+     */
+    RsmsUplinkScheduler(const RsmsUplinkScheduler &) = delete;
+
+    /**
+     * 防止对象被赋值
+     * @return
+     */
+    RsmsUplinkScheduler &operator=(const RsmsUplinkScheduler &) = delete;
+
+    /**
+     * 获取单例
+     * @return 单例
+     */
+    static RsmsUplinkScheduler &get_instance();
+
+public:
+    /**
+     * 加载配置
+     * @param config 配置信息
+     * @return 是否加载成功
+     */
+    bool load_config(const YAML::Node &config);
+
+    /**
+     * 启动
+     * @return 启动是否成功
+     */
+    bool start();
+
+    /**
+     * 停止，停止前发送完已提交的登录登出消息
+     */
+    void stop();
+
+    /**
+     * 设置上行消息监听器
+     * @param listener 监听器
+     */
+    void set_listener(RsmsUplinkListener *listener);
+
+    /**
+     * 提交消息
+     * @param type 优先级
+     * @param topic 主题
+     * @param payload 数据
+     * @param tag 标识，回调时原样返回
+     * @return 是否提交成功，队列已满时返回失败且不回调监听器；
+     *         实时信息排队超时或连接断开时以发送失败回调监听器
+     */
+    bool submit(uplink_class_t type, const std::string &topic, std::vector<uint8_t> &&payload, uint64_t tag = 0);
+
+    /**
+     * 撤回尚在优先级队列中的消息，撤回后不再回调监听器
+     * @param type 优先级
+     * @param tag 提交时的标识
+     * @return 是否撤回，消息已取出发送时返回失败，发送结果照常回调
+     */
+    bool withdraw(uplink_class_t type, uint64_t tag);
+
+    /**
+     * 获取统计
+     * @param type 优先级
+     * @return 统计
+     */
+    uplink_metrics_t get_metrics(uplink_class_t type);
+
+    void on_publish_sent(uint64_t token, int mid, bool is_success) override;
+
+    void on_publish_ack(int mid) override;
+
+    void on_connection_lost() override;
+
+private:
+    // 待发送消息
+    struct uplink_message_t {
+        uplink_class_t type; // 优先级
+        std::string topic; // 主题
+        std::vector<uint8_t> payload; // 数据
+        uint64_t tag; // 标识
+        std::chrono::steady_clock::time_point enqueue_time; // 入队时间
+    };
+    // 已提交到MQTT客户端或已发送待确认消息
+    struct uplink_inflight_t {
+        uplink_class_t type; // 优先级
+        uint64_t tag; // 标识
+        std::chrono::steady_clock::time_point enqueue_time; // 入队时间
+        std::chrono::steady_clock::time_point publish_time; // 发送时间
+    };
+
+    // 是否启动
+    std::atomic_bool is_started_{false};
+    // 发送线程
+    std::thread dispatch_thread_;
+    // 队列锁
+    std::mutex queue_mutex_;
+    // 队列条件
+    std::condition_variable cv_queue_;
+    // 各优先级队列
+    std::deque<uplink_message_t> queues_[UPLINK_CLASS_COUNT];
+    // 各优先级统计
+    uplink_metrics_t metrics_[UPLINK_CLASS_COUNT]{};
+    // 各优先级累计排队时间
+    double total_wait_ms_[UPLINK_CLASS_COUNT]{};
+    // 单个队列深度上限
+    size_t max_queue_depth_ = 1000;
+    // 补发信息保留份额
+    double reissue_share_ = 0.1;
+    // 补发信息的发送额度，每发送一条消息增加保留份额
+    double reissue_credit_ = 0;
+    // 统计日志间隔
+    int metrics_interval_second_ = 60;
+    // 实时信息过期秒数（MQTT v5），连接恢复后不再投递过期的实时信息，0为不过期
+    uint32_t realtime_expiry_second_ = 60;
+    // 实时信息最大排队秒数，超过后交回监听器转为补发，0为不限
+    int realtime_max_age_second_ = 30;
+    // 确认锁
+    std::mutex ack_mutex_;
+    // 最近一次提交到MQTT客户端的标识
+    uint64_t last_token_ = 0;
+    // 已提交到MQTT客户端、尚未发布的消息，按标识索引
+    std::map<uint64_t, uplink_inflight_t> submitted_;
+    // 已发送待确认消息
+    std::map<int, uplink_inflight_t> inflight_;
+    // 上行消息监听器
+    std::atomic<RsmsUplinkListener *> listener_{nullptr};
+
+private:
+    /**
+     * 构造函数
+     */
+    RsmsUplinkScheduler() = default;
+
+    /**
+     * 按优先级与补发保留份额取出下一条消息（调用方持有队列锁）
+     * @param is_control_only 是否只取登录登出消息
+     * @param out_message 消息
+     * @return 是否取出
+     */
+    bool pop_next(bool is_control_only, uplink_message_t &out_message);
+
+    /**
+     * 提交消息到MQTT客户端的发布队列，发布结果由on_publish_sent回调
+     * @param message 消息
+     * @return 是否已处理，发布队列已满时返回失败且消息保持不变
+     */
+    bool dispatch(uplink_message_t &message);
+
+    /**
+     * 取出排队超时的实时信息，以发送失败回调监听器转为补发
+     * @param is_all 是否取出全部实时信息（连接断开时）
+     */
+    void expire_realtime(bool is_all);
+
+    /**
+     * 输出统计日志
+     */
+    void log_metrics();
+
+    /**
+     * 发送消息的线程函数
+     */
+    void dispatch_thread();
+};
+
+#endif //RSMSAPP_RSMS_UPLINK_SCHEDULER_H
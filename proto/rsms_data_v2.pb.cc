@@ -0,0 +1,2435 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rsms_data_v2.proto
+
+#include "rsms_data_v2.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+namespace tbox {
+namespace mcu {
+namespace rsms {
+namespace v2 {
+class RsmsDeltaDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RsmsDelta> _instance;
+} _RsmsDelta_default_instance_;
+class FastDataDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<FastData> _instance;
+} _FastData_default_instance_;
+class PositionDataDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PositionData> _instance;
+} _PositionData_default_instance_;
+class CellDataDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<CellData> _instance;
+} _CellData_default_instance_;
+class SlowDataDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SlowData> _instance;
+} _SlowData_default_instance_;
+}  // namespace v2
+}  // namespace rsms
+}  // namespace mcu
+}  // namespace tbox
+static void InitDefaultsscc_info_CellData_rsms_5fdata_5fv2_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::tbox::mcu::rsms::v2::_CellData_default_instance_;
+    new (ptr) ::tbox::mcu::rsms::v2::CellData();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::tbox::mcu::rsms::v2::CellData::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_CellData_rsms_5fdata_5fv2_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_CellData_rsms_5fdata_5fv2_2eproto}, {}};
+
+static void InitDefaultsscc_info_FastData_rsms_5fdata_5fv2_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::tbox::mcu::rsms::v2::_FastData_default_instance_;
+    new (ptr) ::tbox::mcu::rsms::v2::FastData();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::tbox::mcu::rsms::v2::FastData::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FastData_rsms_5fdata_5fv2_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_FastData_rsms_5fdata_5fv2_2eproto}, {}};
+
+static void InitDefaultsscc_info_PositionData_rsms_5fdata_5fv2_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::tbox::mcu::rsms::v2::_PositionData_default_instance_;
+    new (ptr) ::tbox::mcu::rsms::v2::PositionData();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::tbox::mcu::rsms::v2::PositionData::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PositionData_rsms_5fdata_5fv2_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PositionData_rsms_5fdata_5fv2_2eproto}, {}};
+
+static void InitDefaultsscc_info_RsmsDelta_rsms_5fdata_5fv2_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::tbox::mcu::rsms::v2::_RsmsDelta_default_instance_;
+    new (ptr) ::tbox::mcu::rsms::v2::RsmsDelta();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::tbox::mcu::rsms::v2::RsmsDelta::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RsmsDelta_rsms_5fdata_5fv2_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RsmsDelta_rsms_5fdata_5fv2_2eproto}, {}};
+
+static void InitDefaultsscc_info_SlowData_rsms_5fdata_5fv2_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::tbox::mcu::rsms::v2::_SlowData_default_instance_;
+    new (ptr) ::tbox::mcu::rsms::v2::SlowData();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::tbox::mcu::rsms::v2::SlowData::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SlowData_rsms_5fdata_5fv2_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_SlowData_rsms_5fdata_5fv2_2eproto}, {}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_rsms_5fdata_5fv2_2eproto[5];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_rsms_5fdata_5fv2_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_rsms_5fdata_5fv2_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_rsms_5fdata_5fv2_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::RsmsDelta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::RsmsDelta, sequence_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::RsmsDelta, keyframe_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::RsmsDelta, presence_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::RsmsDelta, values_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, speed_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, total_voltage_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, total_current_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, soc_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, gear_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, driving_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, braking_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, accelerator_pedal_position_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, brake_pedal_position_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, motor_state_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, motor_controller_temperature_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, motor_speed_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, motor_torque_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, motor_temperature_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, motor_controller_input_voltage_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::FastData, motor_controller_dc_bus_current_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::PositionData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::PositionData, state_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::PositionData, longitude_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::PositionData, latitude_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::CellData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::CellData, sn_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::CellData, voltage_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::CellData, current_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::CellData, cell_count_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::CellData, frame_start_cell_sn_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::CellData, cell_voltages_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, vehicle_state_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, charging_state_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, running_mode_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, total_odometer_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, dcdc_state_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, insulation_resistance_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, battery_sn_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, probe_temperatures_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, extremum_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, max_alarm_level_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, alarm_flag_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, battery_fault_list_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, drive_motor_fault_list_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, engine_fault_list_),
+  PROTOBUF_FIELD_OFFSET(::tbox::mcu::rsms::v2::SlowData, other_fault_list_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::tbox::mcu::rsms::v2::RsmsDelta)},
+  { 9, -1, sizeof(::tbox::mcu::rsms::v2::FastData)},
+  { 30, -1, sizeof(::tbox::mcu::rsms::v2::PositionData)},
+  { 38, -1, sizeof(::tbox::mcu::rsms::v2::CellData)},
+  { 49, -1, sizeof(::tbox::mcu::rsms::v2::SlowData)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tbox::mcu::rsms::v2::_RsmsDelta_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tbox::mcu::rsms::v2::_FastData_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tbox::mcu::rsms::v2::_PositionData_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tbox::mcu::rsms::v2::_CellData_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tbox::mcu::rsms::v2::_SlowData_default_instance_),
+};
+
+const char descriptor_table_protodef_rsms_5fdata_5fv2_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022rsms_data_v2.proto\022\020tbox.mcu.rsms.v2\"Q"
+  "\n\tRsmsDelta\022\020\n\010sequence\030\001 \001(\r\022\020\n\010keyfram"
+  "e\030\002 \001(\010\022\020\n\010presence\030\003 \003(\006\022\016\n\006values\030\004 \003("
+  "\r\"\230\003\n\010FastData\022\r\n\005speed\030\001 \001(\r\022\025\n\rtotal_v"
+  "oltage\030\002 \001(\r\022\025\n\rtotal_current\030\003 \001(\r\022\013\n\003s"
+  "oc\030\004 \001(\r\022\014\n\004gear\030\005 \001(\r\022\017\n\007driving\030\006 \001(\010\022"
+  "\017\n\007braking\030\007 \001(\010\022\"\n\032accelerator_pedal_po"
+  "sition\030\010 \001(\r\022\034\n\024brake_pedal_position\030\t \001"
+  "(\r\022\023\n\013motor_state\030\n \003(\r\022$\n\034motor_control"
+  "ler_temperature\030\013 \003(\r\022\023\n\013motor_speed\030\014 \003"
+  "(\r\022\024\n\014motor_torque\030\r \003(\r\022\031\n\021motor_temper"
+  "ature\030\016 \003(\r\022&\n\036motor_controller_input_vo"
+  "ltage\030\017 \003(\r\022\'\n\037motor_controller_dc_bus_c"
+  "urrent\030\020 \003(\r\"B\n\014PositionData\022\r\n\005state\030\001 "
+  "\001(\r\022\021\n\tlongitude\030\002 \001(\007\022\020\n\010latitude\030\003 \001(\007"
+  "\"\200\001\n\010CellData\022\n\n\002sn\030\001 \001(\r\022\017\n\007voltage\030\002 \001"
+  "(\r\022\017\n\007current\030\003 \001(\r\022\022\n\ncell_count\030\004 \001(\r\022"
+  "\033\n\023frame_start_cell_sn\030\005 \001(\r\022\025\n\rcell_vol"
+  "tages\030\006 \001(\014\"\372\002\n\010SlowData\022\025\n\rvehicle_stat"
+  "e\030\001 \001(\r\022\026\n\016charging_state\030\002 \001(\r\022\024\n\014runni"
+  "ng_mode\030\003 \001(\r\022\026\n\016total_odometer\030\004 \001(\r\022\022\n"
+  "\ndcdc_state\030\005 \001(\r\022\035\n\025insulation_resistan"
+  "ce\030\006 \001(\r\022\022\n\nbattery_sn\030\007 \001(\r\022\032\n\022probe_te"
+  "mperatures\030\010 \001(\014\022\020\n\010extremum\030\t \003(\r\022\027\n\017ma"
+  "x_alarm_level\030\n \001(\r\022\022\n\nalarm_flag\030\013 \001(\007\022"
+  "\032\n\022battery_fault_list\030\014 \003(\007\022\036\n\026drive_mot"
+  "or_fault_list\030\r \003(\007\022\031\n\021engine_fault_list"
+  "\030\016 \003(\007\022\030\n\020other_fault_list\030\017 \003(\007b\006proto3"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_rsms_5fdata_5fv2_2eproto_deps[1] = {
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_rsms_5fdata_5fv2_2eproto_sccs[5] = {
+  &scc_info_CellData_rsms_5fdata_5fv2_2eproto.base,
+  &scc_info_FastData_rsms_5fdata_5fv2_2eproto.base,
+  &scc_info_PositionData_rsms_5fdata_5fv2_2eproto.base,
+  &scc_info_RsmsDelta_rsms_5fdata_5fv2_2eproto.base,
+  &scc_info_SlowData_rsms_5fdata_5fv2_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_rsms_5fdata_5fv2_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rsms_5fdata_5fv2_2eproto = {
+  false, false, descriptor_table_protodef_rsms_5fdata_5fv2_2eproto, "rsms_data_v2.proto", 1120,
+  &descriptor_table_rsms_5fdata_5fv2_2eproto_once, descriptor_table_rsms_5fdata_5fv2_2eproto_sccs, descriptor_table_rsms_5fdata_5fv2_2eproto_deps, 5, 0,
+  schemas, file_default_instances, TableStruct_rsms_5fdata_5fv2_2eproto::offsets,
+  file_level_metadata_rsms_5fdata_5fv2_2eproto, 5, file_level_enum_descriptors_rsms_5fdata_5fv2_2eproto, file_level_service_descriptors_rsms_5fdata_5fv2_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_rsms_5fdata_5fv2_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_rsms_5fdata_5fv2_2eproto)), true);
+namespace tbox {
+namespace mcu {
+namespace rsms {
+namespace v2 {
+
+// ===================================================================
+
+void RsmsDelta::InitAsDefaultInstance() {
+}
+class RsmsDelta::_Internal {
+ public:
+};
+
+RsmsDelta::RsmsDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  presence_(arena),
+  values_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:tbox.mcu.rsms.v2.RsmsDelta)
+}
+RsmsDelta::RsmsDelta(const RsmsDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      presence_(from.presence_),
+      values_(from.values_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&sequence_, &from.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&keyframe_) -
+    reinterpret_cast<char*>(&sequence_)) + sizeof(keyframe_));
+  // @@protoc_insertion_point(copy_constructor:tbox.mcu.rsms.v2.RsmsDelta)
+}
+
+void RsmsDelta::SharedCtor() {
+  ::memset(&sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&keyframe_) -
+      reinterpret_cast<char*>(&sequence_)) + sizeof(keyframe_));
+}
+
+RsmsDelta::~RsmsDelta() {
+  // @@protoc_insertion_point(destructor:tbox.mcu.rsms.v2.RsmsDelta)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RsmsDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void RsmsDelta::ArenaDtor(void* object) {
+  RsmsDelta* _this = reinterpret_cast< RsmsDelta* >(object);
+  (void)_this;
+}
+void RsmsDelta::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RsmsDelta::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RsmsDelta& RsmsDelta::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RsmsDelta_rsms_5fdata_5fv2_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void RsmsDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:tbox.mcu.rsms.v2.RsmsDelta)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  presence_.Clear();
+  values_.Clear();
+  ::memset(&sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&keyframe_) -
+      reinterpret_cast<char*>(&sequence_)) + sizeof(keyframe_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RsmsDelta::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint32 sequence = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool keyframe = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          keyframe_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed64 presence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_presence(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25) {
+          _internal_add_presence(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 values = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_values(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32) {
+          _internal_add_values(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RsmsDelta::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tbox.mcu.rsms.v2.RsmsDelta)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 sequence = 1;
+  if (this->sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_sequence(), target);
+  }
+
+  // bool keyframe = 2;
+  if (this->keyframe() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_keyframe(), target);
+  }
+
+  // repeated fixed64 presence = 3;
+  if (this->_internal_presence_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_presence(), target);
+  }
+
+  // repeated uint32 values = 4;
+  {
+    int byte_size = _values_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_values(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tbox.mcu.rsms.v2.RsmsDelta)
+  return target;
+}
+
+size_t RsmsDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tbox.mcu.rsms.v2.RsmsDelta)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 presence = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_presence_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _presence_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 values = 4;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->values_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _values_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint32 sequence = 1;
+  if (this->sequence() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_sequence());
+  }
+
+  // bool keyframe = 2;
+  if (this->keyframe() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RsmsDelta::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:tbox.mcu.rsms.v2.RsmsDelta)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RsmsDelta* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RsmsDelta>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:tbox.mcu.rsms.v2.RsmsDelta)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:tbox.mcu.rsms.v2.RsmsDelta)
+    MergeFrom(*source);
+  }
+}
+
+void RsmsDelta::MergeFrom(const RsmsDelta& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tbox.mcu.rsms.v2.RsmsDelta)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  presence_.MergeFrom(from.presence_);
+  values_.MergeFrom(from.values_);
+  if (from.sequence() != 0) {
+    _internal_set_sequence(from._internal_sequence());
+  }
+  if (from.keyframe() != 0) {
+    _internal_set_keyframe(from._internal_keyframe());
+  }
+}
+
+void RsmsDelta::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:tbox.mcu.rsms.v2.RsmsDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RsmsDelta::CopyFrom(const RsmsDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tbox.mcu.rsms.v2.RsmsDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RsmsDelta::IsInitialized() const {
+  return true;
+}
+
+void RsmsDelta::InternalSwap(RsmsDelta* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  presence_.InternalSwap(&other->presence_);
+  values_.InternalSwap(&other->values_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RsmsDelta, keyframe_)
+      + sizeof(RsmsDelta::keyframe_)
+      - PROTOBUF_FIELD_OFFSET(RsmsDelta, sequence_)>(
+          reinterpret_cast<char*>(&sequence_),
+          reinterpret_cast<char*>(&other->sequence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RsmsDelta::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void FastData::InitAsDefaultInstance() {
+}
+class FastData::_Internal {
+ public:
+};
+
+FastData::FastData(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  motor_state_(arena),
+  motor_controller_temperature_(arena),
+  motor_speed_(arena),
+  motor_torque_(arena),
+  motor_temperature_(arena),
+  motor_controller_input_voltage_(arena),
+  motor_controller_dc_bus_current_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:tbox.mcu.rsms.v2.FastData)
+}
+FastData::FastData(const FastData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      motor_state_(from.motor_state_),
+      motor_controller_temperature_(from.motor_controller_temperature_),
+      motor_speed_(from.motor_speed_),
+      motor_torque_(from.motor_torque_),
+      motor_temperature_(from.motor_temperature_),
+      motor_controller_input_voltage_(from.motor_controller_input_voltage_),
+      motor_controller_dc_bus_current_(from.motor_controller_dc_bus_current_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&speed_, &from.speed_,
+    static_cast<size_t>(reinterpret_cast<char*>(&brake_pedal_position_) -
+    reinterpret_cast<char*>(&speed_)) + sizeof(brake_pedal_position_));
+  // @@protoc_insertion_point(copy_constructor:tbox.mcu.rsms.v2.FastData)
+}
+
+void FastData::SharedCtor() {
+  ::memset(&speed_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&brake_pedal_position_) -
+      reinterpret_cast<char*>(&speed_)) + sizeof(brake_pedal_position_));
+}
+
+FastData::~FastData() {
+  // @@protoc_insertion_point(destructor:tbox.mcu.rsms.v2.FastData)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void FastData::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void FastData::ArenaDtor(void* object) {
+  FastData* _this = reinterpret_cast< FastData* >(object);
+  (void)_this;
+}
+void FastData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void FastData::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const FastData& FastData::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FastData_rsms_5fdata_5fv2_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void FastData::Clear() {
+// @@protoc_insertion_point(message_clear_start:tbox.mcu.rsms.v2.FastData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  motor_state_.Clear();
+  motor_controller_temperature_.Clear();
+  motor_speed_.Clear();
+  motor_torque_.Clear();
+  motor_temperature_.Clear();
+  motor_controller_input_voltage_.Clear();
+  motor_controller_dc_bus_current_.Clear();
+  ::memset(&speed_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&brake_pedal_position_) -
+      reinterpret_cast<char*>(&speed_)) + sizeof(brake_pedal_position_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FastData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint32 speed = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 total_voltage = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          total_voltage_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 total_current = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          total_current_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 soc = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          soc_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 gear = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          gear_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool driving = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          driving_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool braking = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          braking_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 accelerator_pedal_position = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          accelerator_pedal_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 brake_pedal_position = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          brake_pedal_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 motor_state = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_motor_state(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80) {
+          _internal_add_motor_state(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 motor_controller_temperature = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_motor_controller_temperature(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88) {
+          _internal_add_motor_controller_temperature(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 motor_speed = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_motor_speed(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 96) {
+          _internal_add_motor_speed(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 motor_torque = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_motor_torque(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 104) {
+          _internal_add_motor_torque(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 motor_temperature = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_motor_temperature(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 112) {
+          _internal_add_motor_temperature(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 motor_controller_input_voltage = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_motor_controller_input_voltage(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 120) {
+          _internal_add_motor_controller_input_voltage(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 motor_controller_dc_bus_current = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_motor_controller_dc_bus_current(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 128) {
+          _internal_add_motor_controller_dc_bus_current(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* FastData::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tbox.mcu.rsms.v2.FastData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 speed = 1;
+  if (this->speed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_speed(), target);
+  }
+
+  // uint32 total_voltage = 2;
+  if (this->total_voltage() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_total_voltage(), target);
+  }
+
+  // uint32 total_current = 3;
+  if (this->total_current() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_total_current(), target);
+  }
+
+  // uint32 soc = 4;
+  if (this->soc() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_soc(), target);
+  }
+
+  // uint32 gear = 5;
+  if (this->gear() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(5, this->_internal_gear(), target);
+  }
+
+  // bool driving = 6;
+  if (this->driving() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(6, this->_internal_driving(), target);
+  }
+
+  // bool braking = 7;
+  if (this->braking() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(7, this->_internal_braking(), target);
+  }
+
+  // uint32 accelerator_pedal_position = 8;
+  if (this->accelerator_pedal_position() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(8, this->_internal_accelerator_pedal_position(), target);
+  }
+
+  // uint32 brake_pedal_position = 9;
+  if (this->brake_pedal_position() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(9, this->_internal_brake_pedal_position(), target);
+  }
+
+  // repeated uint32 motor_state = 10;
+  {
+    int byte_size = _motor_state_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          10, _internal_motor_state(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 motor_controller_temperature = 11;
+  {
+    int byte_size = _motor_controller_temperature_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          11, _internal_motor_controller_temperature(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 motor_speed = 12;
+  {
+    int byte_size = _motor_speed_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          12, _internal_motor_speed(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 motor_torque = 13;
+  {
+    int byte_size = _motor_torque_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          13, _internal_motor_torque(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 motor_temperature = 14;
+  {
+    int byte_size = _motor_temperature_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          14, _internal_motor_temperature(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 motor_controller_input_voltage = 15;
+  {
+    int byte_size = _motor_controller_input_voltage_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          15, _internal_motor_controller_input_voltage(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 motor_controller_dc_bus_current = 16;
+  {
+    int byte_size = _motor_controller_dc_bus_current_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          16, _internal_motor_controller_dc_bus_current(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tbox.mcu.rsms.v2.FastData)
+  return target;
+}
+
+size_t FastData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tbox.mcu.rsms.v2.FastData)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 motor_state = 10;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->motor_state_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _motor_state_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 motor_controller_temperature = 11;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->motor_controller_temperature_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _motor_controller_temperature_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 motor_speed = 12;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->motor_speed_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _motor_speed_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 motor_torque = 13;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->motor_torque_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _motor_torque_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 motor_temperature = 14;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->motor_temperature_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _motor_temperature_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 motor_controller_input_voltage = 15;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->motor_controller_input_voltage_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _motor_controller_input_voltage_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 motor_controller_dc_bus_current = 16;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->motor_controller_dc_bus_current_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _motor_controller_dc_bus_current_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint32 speed = 1;
+  if (this->speed() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_speed());
+  }
+
+  // uint32 total_voltage = 2;
+  if (this->total_voltage() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_total_voltage());
+  }
+
+  // uint32 total_current = 3;
+  if (this->total_current() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_total_current());
+  }
+
+  // uint32 soc = 4;
+  if (this->soc() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_soc());
+  }
+
+  // uint32 gear = 5;
+  if (this->gear() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_gear());
+  }
+
+  // bool driving = 6;
+  if (this->driving() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool braking = 7;
+  if (this->braking() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 accelerator_pedal_position = 8;
+  if (this->accelerator_pedal_position() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_accelerator_pedal_position());
+  }
+
+  // uint32 brake_pedal_position = 9;
+  if (this->brake_pedal_position() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_brake_pedal_position());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FastData::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:tbox.mcu.rsms.v2.FastData)
+  GOOGLE_DCHECK_NE(&from, this);
+  const FastData* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FastData>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:tbox.mcu.rsms.v2.FastData)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:tbox.mcu.rsms.v2.FastData)
+    MergeFrom(*source);
+  }
+}
+
+void FastData::MergeFrom(const FastData& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tbox.mcu.rsms.v2.FastData)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  motor_state_.MergeFrom(from.motor_state_);
+  motor_controller_temperature_.MergeFrom(from.motor_controller_temperature_);
+  motor_speed_.MergeFrom(from.motor_speed_);
+  motor_torque_.MergeFrom(from.motor_torque_);
+  motor_temperature_.MergeFrom(from.motor_temperature_);
+  motor_controller_input_voltage_.MergeFrom(from.motor_controller_input_voltage_);
+  motor_controller_dc_bus_current_.MergeFrom(from.motor_controller_dc_bus_current_);
+  if (from.speed() != 0) {
+    _internal_set_speed(from._internal_speed());
+  }
+  if (from.total_voltage() != 0) {
+    _internal_set_total_voltage(from._internal_total_voltage());
+  }
+  if (from.total_current() != 0) {
+    _internal_set_total_current(from._internal_total_current());
+  }
+  if (from.soc() != 0) {
+    _internal_set_soc(from._internal_soc());
+  }
+  if (from.gear() != 0) {
+    _internal_set_gear(from._internal_gear());
+  }
+  if (from.driving() != 0) {
+    _internal_set_driving(from._internal_driving());
+  }
+  if (from.braking() != 0) {
+    _internal_set_braking(from._internal_braking());
+  }
+  if (from.accelerator_pedal_position() != 0) {
+    _internal_set_accelerator_pedal_position(from._internal_accelerator_pedal_position());
+  }
+  if (from.brake_pedal_position() != 0) {
+    _internal_set_brake_pedal_position(from._internal_brake_pedal_position());
+  }
+}
+
+void FastData::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:tbox.mcu.rsms.v2.FastData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void FastData::CopyFrom(const FastData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tbox.mcu.rsms.v2.FastData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FastData::IsInitialized() const {
+  return true;
+}
+
+void FastData::InternalSwap(FastData* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  motor_state_.InternalSwap(&other->motor_state_);
+  motor_controller_temperature_.InternalSwap(&other->motor_controller_temperature_);
+  motor_speed_.InternalSwap(&other->motor_speed_);
+  motor_torque_.InternalSwap(&other->motor_torque_);
+  motor_temperature_.InternalSwap(&other->motor_temperature_);
+  motor_controller_input_voltage_.InternalSwap(&other->motor_controller_input_voltage_);
+  motor_controller_dc_bus_current_.InternalSwap(&other->motor_controller_dc_bus_current_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FastData, brake_pedal_position_)
+      + sizeof(FastData::brake_pedal_position_)
+      - PROTOBUF_FIELD_OFFSET(FastData, speed_)>(
+          reinterpret_cast<char*>(&speed_),
+          reinterpret_cast<char*>(&other->speed_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FastData::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void PositionData::InitAsDefaultInstance() {
+}
+class PositionData::_Internal {
+ public:
+};
+
+PositionData::PositionData(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:tbox.mcu.rsms.v2.PositionData)
+}
+PositionData::PositionData(const PositionData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&state_, &from.state_,
+    static_cast<size_t>(reinterpret_cast<char*>(&latitude_) -
+    reinterpret_cast<char*>(&state_)) + sizeof(latitude_));
+  // @@protoc_insertion_point(copy_constructor:tbox.mcu.rsms.v2.PositionData)
+}
+
+void PositionData::SharedCtor() {
+  ::memset(&state_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&latitude_) -
+      reinterpret_cast<char*>(&state_)) + sizeof(latitude_));
+}
+
+PositionData::~PositionData() {
+  // @@protoc_insertion_point(destructor:tbox.mcu.rsms.v2.PositionData)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void PositionData::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void PositionData::ArenaDtor(void* object) {
+  PositionData* _this = reinterpret_cast< PositionData* >(object);
+  (void)_this;
+}
+void PositionData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void PositionData::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PositionData& PositionData::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PositionData_rsms_5fdata_5fv2_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void PositionData::Clear() {
+// @@protoc_insertion_point(message_clear_start:tbox.mcu.rsms.v2.PositionData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&state_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&latitude_) -
+      reinterpret_cast<char*>(&state_)) + sizeof(latitude_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PositionData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint32 state = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // fixed32 longitude = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
+          longitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      // fixed32 latitude = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
+          latitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PositionData::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tbox.mcu.rsms.v2.PositionData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 state = 1;
+  if (this->state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_state(), target);
+  }
+
+  // fixed32 longitude = 2;
+  if (this->longitude() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(2, this->_internal_longitude(), target);
+  }
+
+  // fixed32 latitude = 3;
+  if (this->latitude() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(3, this->_internal_latitude(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tbox.mcu.rsms.v2.PositionData)
+  return target;
+}
+
+size_t PositionData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tbox.mcu.rsms.v2.PositionData)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 state = 1;
+  if (this->state() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_state());
+  }
+
+  // fixed32 longitude = 2;
+  if (this->longitude() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // fixed32 latitude = 3;
+  if (this->latitude() != 0) {
+    total_size += 1 + 4;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PositionData::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:tbox.mcu.rsms.v2.PositionData)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PositionData* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PositionData>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:tbox.mcu.rsms.v2.PositionData)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:tbox.mcu.rsms.v2.PositionData)
+    MergeFrom(*source);
+  }
+}
+
+void PositionData::MergeFrom(const PositionData& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tbox.mcu.rsms.v2.PositionData)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.state() != 0) {
+    _internal_set_state(from._internal_state());
+  }
+  if (from.longitude() != 0) {
+    _internal_set_longitude(from._internal_longitude());
+  }
+  if (from.latitude() != 0) {
+    _internal_set_latitude(from._internal_latitude());
+  }
+}
+
+void PositionData::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:tbox.mcu.rsms.v2.PositionData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PositionData::CopyFrom(const PositionData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tbox.mcu.rsms.v2.PositionData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PositionData::IsInitialized() const {
+  return true;
+}
+
+void PositionData::InternalSwap(PositionData* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PositionData, latitude_)
+      + sizeof(PositionData::latitude_)
+      - PROTOBUF_FIELD_OFFSET(PositionData, state_)>(
+          reinterpret_cast<char*>(&state_),
+          reinterpret_cast<char*>(&other->state_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PositionData::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void CellData::InitAsDefaultInstance() {
+}
+class CellData::_Internal {
+ public:
+};
+
+CellData::CellData(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:tbox.mcu.rsms.v2.CellData)
+}
+CellData::CellData(const CellData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  cell_voltages_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_cell_voltages().empty()) {
+    cell_voltages_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_cell_voltages(),
+      GetArena());
+  }
+  ::memcpy(&sn_, &from.sn_,
+    static_cast<size_t>(reinterpret_cast<char*>(&frame_start_cell_sn_) -
+    reinterpret_cast<char*>(&sn_)) + sizeof(frame_start_cell_sn_));
+  // @@protoc_insertion_point(copy_constructor:tbox.mcu.rsms.v2.CellData)
+}
+
+void CellData::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_CellData_rsms_5fdata_5fv2_2eproto.base);
+  cell_voltages_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&sn_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&frame_start_cell_sn_) -
+      reinterpret_cast<char*>(&sn_)) + sizeof(frame_start_cell_sn_));
+}
+
+CellData::~CellData() {
+  // @@protoc_insertion_point(destructor:tbox.mcu.rsms.v2.CellData)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void CellData::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  cell_voltages_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void CellData::ArenaDtor(void* object) {
+  CellData* _this = reinterpret_cast< CellData* >(object);
+  (void)_this;
+}
+void CellData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void CellData::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const CellData& CellData::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_CellData_rsms_5fdata_5fv2_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void CellData::Clear() {
+// @@protoc_insertion_point(message_clear_start:tbox.mcu.rsms.v2.CellData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cell_voltages_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::memset(&sn_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&frame_start_cell_sn_) -
+      reinterpret_cast<char*>(&sn_)) + sizeof(frame_start_cell_sn_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CellData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint32 sn = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          sn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 voltage = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          voltage_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 current = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          current_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 cell_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          cell_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 frame_start_cell_sn = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          frame_start_cell_sn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes cell_voltages = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          auto str = _internal_mutable_cell_voltages();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* CellData::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tbox.mcu.rsms.v2.CellData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 sn = 1;
+  if (this->sn() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_sn(), target);
+  }
+
+  // uint32 voltage = 2;
+  if (this->voltage() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_voltage(), target);
+  }
+
+  // uint32 current = 3;
+  if (this->current() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_current(), target);
+  }
+
+  // uint32 cell_count = 4;
+  if (this->cell_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_cell_count(), target);
+  }
+
+  // uint32 frame_start_cell_sn = 5;
+  if (this->frame_start_cell_sn() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(5, this->_internal_frame_start_cell_sn(), target);
+  }
+
+  // bytes cell_voltages = 6;
+  if (this->cell_voltages().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_cell_voltages(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tbox.mcu.rsms.v2.CellData)
+  return target;
+}
+
+size_t CellData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tbox.mcu.rsms.v2.CellData)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes cell_voltages = 6;
+  if (this->cell_voltages().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_cell_voltages());
+  }
+
+  // uint32 sn = 1;
+  if (this->sn() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_sn());
+  }
+
+  // uint32 voltage = 2;
+  if (this->voltage() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_voltage());
+  }
+
+  // uint32 current = 3;
+  if (this->current() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_current());
+  }
+
+  // uint32 cell_count = 4;
+  if (this->cell_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_cell_count());
+  }
+
+  // uint32 frame_start_cell_sn = 5;
+  if (this->frame_start_cell_sn() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_frame_start_cell_sn());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CellData::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:tbox.mcu.rsms.v2.CellData)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CellData* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CellData>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:tbox.mcu.rsms.v2.CellData)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:tbox.mcu.rsms.v2.CellData)
+    MergeFrom(*source);
+  }
+}
+
+void CellData::MergeFrom(const CellData& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tbox.mcu.rsms.v2.CellData)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.cell_voltages().size() > 0) {
+    _internal_set_cell_voltages(from._internal_cell_voltages());
+  }
+  if (from.sn() != 0) {
+    _internal_set_sn(from._internal_sn());
+  }
+  if (from.voltage() != 0) {
+    _internal_set_voltage(from._internal_voltage());
+  }
+  if (from.current() != 0) {
+    _internal_set_current(from._internal_current());
+  }
+  if (from.cell_count() != 0) {
+    _internal_set_cell_count(from._internal_cell_count());
+  }
+  if (from.frame_start_cell_sn() != 0) {
+    _internal_set_frame_start_cell_sn(from._internal_frame_start_cell_sn());
+  }
+}
+
+void CellData::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:tbox.mcu.rsms.v2.CellData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CellData::CopyFrom(const CellData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tbox.mcu.rsms.v2.CellData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CellData::IsInitialized() const {
+  return true;
+}
+
+void CellData::InternalSwap(CellData* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  cell_voltages_.Swap(&other->cell_voltages_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CellData, frame_start_cell_sn_)
+      + sizeof(CellData::frame_start_cell_sn_)
+      - PROTOBUF_FIELD_OFFSET(CellData, sn_)>(
+          reinterpret_cast<char*>(&sn_),
+          reinterpret_cast<char*>(&other->sn_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CellData::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void SlowData::InitAsDefaultInstance() {
+}
+class SlowData::_Internal {
+ public:
+};
+
+SlowData::SlowData(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  extremum_(arena),
+  battery_fault_list_(arena),
+  drive_motor_fault_list_(arena),
+  engine_fault_list_(arena),
+  other_fault_list_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:tbox.mcu.rsms.v2.SlowData)
+}
+SlowData::SlowData(const SlowData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      extremum_(from.extremum_),
+      battery_fault_list_(from.battery_fault_list_),
+      drive_motor_fault_list_(from.drive_motor_fault_list_),
+      engine_fault_list_(from.engine_fault_list_),
+      other_fault_list_(from.other_fault_list_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  probe_temperatures_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_probe_temperatures().empty()) {
+    probe_temperatures_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_probe_temperatures(),
+      GetArena());
+  }
+  ::memcpy(&vehicle_state_, &from.vehicle_state_,
+    static_cast<size_t>(reinterpret_cast<char*>(&alarm_flag_) -
+    reinterpret_cast<char*>(&vehicle_state_)) + sizeof(alarm_flag_));
+  // @@protoc_insertion_point(copy_constructor:tbox.mcu.rsms.v2.SlowData)
+}
+
+void SlowData::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SlowData_rsms_5fdata_5fv2_2eproto.base);
+  probe_temperatures_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&vehicle_state_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&alarm_flag_) -
+      reinterpret_cast<char*>(&vehicle_state_)) + sizeof(alarm_flag_));
+}
+
+SlowData::~SlowData() {
+  // @@protoc_insertion_point(destructor:tbox.mcu.rsms.v2.SlowData)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void SlowData::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  probe_temperatures_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void SlowData::ArenaDtor(void* object) {
+  SlowData* _this = reinterpret_cast< SlowData* >(object);
+  (void)_this;
+}
+void SlowData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void SlowData::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const SlowData& SlowData::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SlowData_rsms_5fdata_5fv2_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void SlowData::Clear() {
+// @@protoc_insertion_point(message_clear_start:tbox.mcu.rsms.v2.SlowData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  extremum_.Clear();
+  battery_fault_list_.Clear();
+  drive_motor_fault_list_.Clear();
+  engine_fault_list_.Clear();
+  other_fault_list_.Clear();
+  probe_temperatures_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::memset(&vehicle_state_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&alarm_flag_) -
+      reinterpret_cast<char*>(&vehicle_state_)) + sizeof(alarm_flag_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SlowData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint32 vehicle_state = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          vehicle_state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 charging_state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          charging_state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 running_mode = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          running_mode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 total_odometer = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          total_odometer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 dcdc_state = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          dcdc_state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 insulation_resistance = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          insulation_resistance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 battery_sn = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          battery_sn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes probe_temperatures = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          auto str = _internal_mutable_probe_temperatures();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 extremum = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_extremum(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72) {
+          _internal_add_extremum(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 max_alarm_level = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80)) {
+          max_alarm_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // fixed32 alarm_flag = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 93)) {
+          alarm_flag_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed32 battery_fault_list = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_battery_fault_list(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 101) {
+          _internal_add_battery_fault_list(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed32 drive_motor_fault_list = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_drive_motor_fault_list(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 109) {
+          _internal_add_drive_motor_fault_list(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed32 engine_fault_list = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_engine_fault_list(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 117) {
+          _internal_add_engine_fault_list(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed32 other_fault_list = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_other_fault_list(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 125) {
+          _internal_add_other_fault_list(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* SlowData::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tbox.mcu.rsms.v2.SlowData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 vehicle_state = 1;
+  if (this->vehicle_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_vehicle_state(), target);
+  }
+
+  // uint32 charging_state = 2;
+  if (this->charging_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_charging_state(), target);
+  }
+
+  // uint32 running_mode = 3;
+  if (this->running_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_running_mode(), target);
+  }
+
+  // uint32 total_odometer = 4;
+  if (this->total_odometer() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_total_odometer(), target);
+  }
+
+  // uint32 dcdc_state = 5;
+  if (this->dcdc_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(5, this->_internal_dcdc_state(), target);
+  }
+
+  // uint32 insulation_resistance = 6;
+  if (this->insulation_resistance() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(6, this->_internal_insulation_resistance(), target);
+  }
+
+  // uint32 battery_sn = 7;
+  if (this->battery_sn() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(7, this->_internal_battery_sn(), target);
+  }
+
+  // bytes probe_temperatures = 8;
+  if (this->probe_temperatures().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_probe_temperatures(), target);
+  }
+
+  // repeated uint32 extremum = 9;
+  {
+    int byte_size = _extremum_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          9, _internal_extremum(), byte_size, target);
+    }
+  }
+
+  // uint32 max_alarm_level = 10;
+  if (this->max_alarm_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(10, this->_internal_max_alarm_level(), target);
+  }
+
+  // fixed32 alarm_flag = 11;
+  if (this->alarm_flag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(11, this->_internal_alarm_flag(), target);
+  }
+
+  // repeated fixed32 battery_fault_list = 12;
+  if (this->_internal_battery_fault_list_size() > 0) {
+    target = stream->WriteFixedPacked(12, _internal_battery_fault_list(), target);
+  }
+
+  // repeated fixed32 drive_motor_fault_list = 13;
+  if (this->_internal_drive_motor_fault_list_size() > 0) {
+    target = stream->WriteFixedPacked(13, _internal_drive_motor_fault_list(), target);
+  }
+
+  // repeated fixed32 engine_fault_list = 14;
+  if (this->_internal_engine_fault_list_size() > 0) {
+    target = stream->WriteFixedPacked(14, _internal_engine_fault_list(), target);
+  }
+
+  // repeated fixed32 other_fault_list = 15;
+  if (this->_internal_other_fault_list_size() > 0) {
+    target = stream->WriteFixedPacked(15, _internal_other_fault_list(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tbox.mcu.rsms.v2.SlowData)
+  return target;
+}
+
+size_t SlowData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tbox.mcu.rsms.v2.SlowData)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 extremum = 9;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->extremum_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _extremum_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated fixed32 battery_fault_list = 12;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_battery_fault_list_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _battery_fault_list_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated fixed32 drive_motor_fault_list = 13;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_drive_motor_fault_list_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _drive_motor_fault_list_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated fixed32 engine_fault_list = 14;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_engine_fault_list_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _engine_fault_list_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated fixed32 other_fault_list = 15;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_other_fault_list_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _other_fault_list_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // bytes probe_temperatures = 8;
+  if (this->probe_temperatures().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_probe_temperatures());
+  }
+
+  // uint32 vehicle_state = 1;
+  if (this->vehicle_state() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_vehicle_state());
+  }
+
+  // uint32 charging_state = 2;
+  if (this->charging_state() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_charging_state());
+  }
+
+  // uint32 running_mode = 3;
+  if (this->running_mode() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_running_mode());
+  }
+
+  // uint32 total_odometer = 4;
+  if (this->total_odometer() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_total_odometer());
+  }
+
+  // uint32 dcdc_state = 5;
+  if (this->dcdc_state() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_dcdc_state());
+  }
+
+  // uint32 insulation_resistance = 6;
+  if (this->insulation_resistance() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_insulation_resistance());
+  }
+
+  // uint32 battery_sn = 7;
+  if (this->battery_sn() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_battery_sn());
+  }
+
+  // uint32 max_alarm_level = 10;
+  if (this->max_alarm_level() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_max_alarm_level());
+  }
+
+  // fixed32 alarm_flag = 11;
+  if (this->alarm_flag() != 0) {
+    total_size += 1 + 4;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SlowData::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:tbox.mcu.rsms.v2.SlowData)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SlowData* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SlowData>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:tbox.mcu.rsms.v2.SlowData)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:tbox.mcu.rsms.v2.SlowData)
+    MergeFrom(*source);
+  }
+}
+
+void SlowData::MergeFrom(const SlowData& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tbox.mcu.rsms.v2.SlowData)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  extremum_.MergeFrom(from.extremum_);
+  battery_fault_list_.MergeFrom(from.battery_fault_list_);
+  drive_motor_fault_list_.MergeFrom(from.drive_motor_fault_list_);
+  engine_fault_list_.MergeFrom(from.engine_fault_list_);
+  other_fault_list_.MergeFrom(from.other_fault_list_);
+  if (from.probe_temperatures().size() > 0) {
+    _internal_set_probe_temperatures(from._internal_probe_temperatures());
+  }
+  if (from.vehicle_state() != 0) {
+    _internal_set_vehicle_state(from._internal_vehicle_state());
+  }
+  if (from.charging_state() != 0) {
+    _internal_set_charging_state(from._internal_charging_state());
+  }
+  if (from.running_mode() != 0) {
+    _internal_set_running_mode(from._internal_running_mode());
+  }
+  if (from.total_odometer() != 0) {
+    _internal_set_total_odometer(from._internal_total_odometer());
+  }
+  if (from.dcdc_state() != 0) {
+    _internal_set_dcdc_state(from._internal_dcdc_state());
+  }
+  if (from.insulation_resistance() != 0) {
+    _internal_set_insulation_resistance(from._internal_insulation_resistance());
+  }
+  if (from.battery_sn() != 0) {
+    _internal_set_battery_sn(from._internal_battery_sn());
+  }
+  if (from.max_alarm_level() != 0) {
+    _internal_set_max_alarm_level(from._internal_max_alarm_level());
+  }
+  if (from.alarm_flag() != 0) {
+    _internal_set_alarm_flag(from._internal_alarm_flag());
+  }
+}
+
+void SlowData::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:tbox.mcu.rsms.v2.SlowData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SlowData::CopyFrom(const SlowData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tbox.mcu.rsms.v2.SlowData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SlowData::IsInitialized() const {
+  return true;
+}
+
+void SlowData::InternalSwap(SlowData* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  extremum_.InternalSwap(&other->extremum_);
+  battery_fault_list_.InternalSwap(&other->battery_fault_list_);
+  drive_motor_fault_list_.InternalSwap(&other->drive_motor_fault_list_);
+  engine_fault_list_.InternalSwap(&other->engine_fault_list_);
+  other_fault_list_.InternalSwap(&other->other_fault_list_);
+  probe_temperatures_.Swap(&other->probe_temperatures_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SlowData, alarm_flag_)
+      + sizeof(SlowData::alarm_flag_)
+      - PROTOBUF_FIELD_OFFSET(SlowData, vehicle_state_)>(
+          reinterpret_cast<char*>(&vehicle_state_),
+          reinterpret_cast<char*>(&other->vehicle_state_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SlowData::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace v2
+}  // namespace rsms
+}  // namespace mcu
+}  // namespace tbox
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::tbox::mcu::rsms::v2::RsmsDelta* Arena::CreateMaybeMessage< ::tbox::mcu::rsms::v2::RsmsDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tbox::mcu::rsms::v2::RsmsDelta >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tbox::mcu::rsms::v2::FastData* Arena::CreateMaybeMessage< ::tbox::mcu::rsms::v2::FastData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tbox::mcu::rsms::v2::FastData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tbox::mcu::rsms::v2::PositionData* Arena::CreateMaybeMessage< ::tbox::mcu::rsms::v2::PositionData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tbox::mcu::rsms::v2::PositionData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tbox::mcu::rsms::v2::CellData* Arena::CreateMaybeMessage< ::tbox::mcu::rsms::v2::CellData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tbox::mcu::rsms::v2::CellData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tbox::mcu::rsms::v2::SlowData* Arena::CreateMaybeMessage< ::tbox::mcu::rsms::v2::SlowData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tbox::mcu::rsms::v2::SlowData >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
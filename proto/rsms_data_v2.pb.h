@@ -0,0 +1,2863 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rsms_data_v2.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rsms_5fdata_5fv2_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rsms_5fdata_5fv2_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rsms_5fdata_5fv2_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rsms_5fdata_5fv2_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[5]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rsms_5fdata_5fv2_2eproto;
+namespace tbox {
+namespace mcu {
+namespace rsms {
+namespace v2 {
+class CellData;
+class CellDataDefaultTypeInternal;
+extern CellDataDefaultTypeInternal _CellData_default_instance_;
+class FastData;
+class FastDataDefaultTypeInternal;
+extern FastDataDefaultTypeInternal _FastData_default_instance_;
+class PositionData;
+class PositionDataDefaultTypeInternal;
+extern PositionDataDefaultTypeInternal _PositionData_default_instance_;
+class RsmsDelta;
+class RsmsDeltaDefaultTypeInternal;
+extern RsmsDeltaDefaultTypeInternal _RsmsDelta_default_instance_;
+class SlowData;
+class SlowDataDefaultTypeInternal;
+extern SlowDataDefaultTypeInternal _SlowData_default_instance_;
+}  // namespace v2
+}  // namespace rsms
+}  // namespace mcu
+}  // namespace tbox
+PROTOBUF_NAMESPACE_OPEN
+template<> ::tbox::mcu::rsms::v2::CellData* Arena::CreateMaybeMessage<::tbox::mcu::rsms::v2::CellData>(Arena*);
+template<> ::tbox::mcu::rsms::v2::FastData* Arena::CreateMaybeMessage<::tbox::mcu::rsms::v2::FastData>(Arena*);
+template<> ::tbox::mcu::rsms::v2::PositionData* Arena::CreateMaybeMessage<::tbox::mcu::rsms::v2::PositionData>(Arena*);
+template<> ::tbox::mcu::rsms::v2::RsmsDelta* Arena::CreateMaybeMessage<::tbox::mcu::rsms::v2::RsmsDelta>(Arena*);
+template<> ::tbox::mcu::rsms::v2::SlowData* Arena::CreateMaybeMessage<::tbox::mcu::rsms::v2::SlowData>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace tbox {
+namespace mcu {
+namespace rsms {
+namespace v2 {
+
+// ===================================================================
+
+class RsmsDelta PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tbox.mcu.rsms.v2.RsmsDelta) */ {
+ public:
+  inline RsmsDelta() : RsmsDelta(nullptr) {};
+  virtual ~RsmsDelta();
+
+  RsmsDelta(const RsmsDelta& from);
+  RsmsDelta(RsmsDelta&& from) noexcept
+    : RsmsDelta() {
+    *this = ::std::move(from);
+  }
+
+  inline RsmsDelta& operator=(const RsmsDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RsmsDelta& operator=(RsmsDelta&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const RsmsDelta& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const RsmsDelta* internal_default_instance() {
+    return reinterpret_cast<const RsmsDelta*>(
+               &_RsmsDelta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RsmsDelta& a, RsmsDelta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RsmsDelta* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RsmsDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RsmsDelta* New() const final {
+    return CreateMaybeMessage<RsmsDelta>(nullptr);
+  }
+
+  RsmsDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<RsmsDelta>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const RsmsDelta& from);
+  void MergeFrom(const RsmsDelta& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RsmsDelta* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tbox.mcu.rsms.v2.RsmsDelta";
+  }
+  protected:
+  explicit RsmsDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_rsms_5fdata_5fv2_2eproto);
+    return ::descriptor_table_rsms_5fdata_5fv2_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPresenceFieldNumber = 3,
+    kValuesFieldNumber = 4,
+    kSequenceFieldNumber = 1,
+    kKeyframeFieldNumber = 2,
+  };
+  // repeated fixed64 presence = 3;
+  int presence_size() const;
+  private:
+  int _internal_presence_size() const;
+  public:
+  void clear_presence();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_presence(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_presence() const;
+  void _internal_add_presence(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_presence();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 presence(int index) const;
+  void set_presence(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_presence(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      presence() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_presence();
+
+  // repeated uint32 values = 4;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_values(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_values() const;
+  void _internal_add_values(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_values();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 values(int index) const;
+  void set_values(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_values(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_values();
+
+  // uint32 sequence = 1;
+  void clear_sequence();
+  ::PROTOBUF_NAMESPACE_ID::uint32 sequence() const;
+  void set_sequence(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_sequence() const;
+  void _internal_set_sequence(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // bool keyframe = 2;
+  void clear_keyframe();
+  bool keyframe() const;
+  void set_keyframe(bool value);
+  private:
+  bool _internal_keyframe() const;
+  void _internal_set_keyframe(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tbox.mcu.rsms.v2.RsmsDelta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > presence_;
+  mutable std::atomic<int> _presence_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > values_;
+  mutable std::atomic<int> _values_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 sequence_;
+  bool keyframe_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_rsms_5fdata_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FastData PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tbox.mcu.rsms.v2.FastData) */ {
+ public:
+  inline FastData() : FastData(nullptr) {};
+  virtual ~FastData();
+
+  FastData(const FastData& from);
+  FastData(FastData&& from) noexcept
+    : FastData() {
+    *this = ::std::move(from);
+  }
+
+  inline FastData& operator=(const FastData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FastData& operator=(FastData&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const FastData& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const FastData* internal_default_instance() {
+    return reinterpret_cast<const FastData*>(
+               &_FastData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(FastData& a, FastData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FastData* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FastData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline FastData* New() const final {
+    return CreateMaybeMessage<FastData>(nullptr);
+  }
+
+  FastData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<FastData>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const FastData& from);
+  void MergeFrom(const FastData& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FastData* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tbox.mcu.rsms.v2.FastData";
+  }
+  protected:
+  explicit FastData(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_rsms_5fdata_5fv2_2eproto);
+    return ::descriptor_table_rsms_5fdata_5fv2_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMotorStateFieldNumber = 10,
+    kMotorControllerTemperatureFieldNumber = 11,
+    kMotorSpeedFieldNumber = 12,
+    kMotorTorqueFieldNumber = 13,
+    kMotorTemperatureFieldNumber = 14,
+    kMotorControllerInputVoltageFieldNumber = 15,
+    kMotorControllerDcBusCurrentFieldNumber = 16,
+    kSpeedFieldNumber = 1,
+    kTotalVoltageFieldNumber = 2,
+    kTotalCurrentFieldNumber = 3,
+    kSocFieldNumber = 4,
+    kGearFieldNumber = 5,
+    kDrivingFieldNumber = 6,
+    kBrakingFieldNumber = 7,
+    kAcceleratorPedalPositionFieldNumber = 8,
+    kBrakePedalPositionFieldNumber = 9,
+  };
+  // repeated uint32 motor_state = 10;
+  int motor_state_size() const;
+  private:
+  int _internal_motor_state_size() const;
+  public:
+  void clear_motor_state();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_motor_state(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_motor_state() const;
+  void _internal_add_motor_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_motor_state();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 motor_state(int index) const;
+  void set_motor_state(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_motor_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      motor_state() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_motor_state();
+
+  // repeated uint32 motor_controller_temperature = 11;
+  int motor_controller_temperature_size() const;
+  private:
+  int _internal_motor_controller_temperature_size() const;
+  public:
+  void clear_motor_controller_temperature();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_motor_controller_temperature(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_motor_controller_temperature() const;
+  void _internal_add_motor_controller_temperature(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_motor_controller_temperature();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 motor_controller_temperature(int index) const;
+  void set_motor_controller_temperature(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_motor_controller_temperature(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      motor_controller_temperature() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_motor_controller_temperature();
+
+  // repeated uint32 motor_speed = 12;
+  int motor_speed_size() const;
+  private:
+  int _internal_motor_speed_size() const;
+  public:
+  void clear_motor_speed();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_motor_speed(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_motor_speed() const;
+  void _internal_add_motor_speed(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_motor_speed();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 motor_speed(int index) const;
+  void set_motor_speed(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_motor_speed(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      motor_speed() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_motor_speed();
+
+  // repeated uint32 motor_torque = 13;
+  int motor_torque_size() const;
+  private:
+  int _internal_motor_torque_size() const;
+  public:
+  void clear_motor_torque();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_motor_torque(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_motor_torque() const;
+  void _internal_add_motor_torque(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_motor_torque();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 motor_torque(int index) const;
+  void set_motor_torque(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_motor_torque(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      motor_torque() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_motor_torque();
+
+  // repeated uint32 motor_temperature = 14;
+  int motor_temperature_size() const;
+  private:
+  int _internal_motor_temperature_size() const;
+  public:
+  void clear_motor_temperature();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_motor_temperature(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_motor_temperature() const;
+  void _internal_add_motor_temperature(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_motor_temperature();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 motor_temperature(int index) const;
+  void set_motor_temperature(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_motor_temperature(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      motor_temperature() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_motor_temperature();
+
+  // repeated uint32 motor_controller_input_voltage = 15;
+  int motor_controller_input_voltage_size() const;
+  private:
+  int _internal_motor_controller_input_voltage_size() const;
+  public:
+  void clear_motor_controller_input_voltage();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_motor_controller_input_voltage(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_motor_controller_input_voltage() const;
+  void _internal_add_motor_controller_input_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_motor_controller_input_voltage();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 motor_controller_input_voltage(int index) const;
+  void set_motor_controller_input_voltage(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_motor_controller_input_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      motor_controller_input_voltage() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_motor_controller_input_voltage();
+
+  // repeated uint32 motor_controller_dc_bus_current = 16;
+  int motor_controller_dc_bus_current_size() const;
+  private:
+  int _internal_motor_controller_dc_bus_current_size() const;
+  public:
+  void clear_motor_controller_dc_bus_current();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_motor_controller_dc_bus_current(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_motor_controller_dc_bus_current() const;
+  void _internal_add_motor_controller_dc_bus_current(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_motor_controller_dc_bus_current();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 motor_controller_dc_bus_current(int index) const;
+  void set_motor_controller_dc_bus_current(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_motor_controller_dc_bus_current(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      motor_controller_dc_bus_current() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_motor_controller_dc_bus_current();
+
+  // uint32 speed = 1;
+  void clear_speed();
+  ::PROTOBUF_NAMESPACE_ID::uint32 speed() const;
+  void set_speed(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_speed() const;
+  void _internal_set_speed(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 total_voltage = 2;
+  void clear_total_voltage();
+  ::PROTOBUF_NAMESPACE_ID::uint32 total_voltage() const;
+  void set_total_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_total_voltage() const;
+  void _internal_set_total_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 total_current = 3;
+  void clear_total_current();
+  ::PROTOBUF_NAMESPACE_ID::uint32 total_current() const;
+  void set_total_current(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_total_current() const;
+  void _internal_set_total_current(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 soc = 4;
+  void clear_soc();
+  ::PROTOBUF_NAMESPACE_ID::uint32 soc() const;
+  void set_soc(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_soc() const;
+  void _internal_set_soc(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 gear = 5;
+  void clear_gear();
+  ::PROTOBUF_NAMESPACE_ID::uint32 gear() const;
+  void set_gear(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_gear() const;
+  void _internal_set_gear(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // bool driving = 6;
+  void clear_driving();
+  bool driving() const;
+  void set_driving(bool value);
+  private:
+  bool _internal_driving() const;
+  void _internal_set_driving(bool value);
+  public:
+
+  // bool braking = 7;
+  void clear_braking();
+  bool braking() const;
+  void set_braking(bool value);
+  private:
+  bool _internal_braking() const;
+  void _internal_set_braking(bool value);
+  public:
+
+  // uint32 accelerator_pedal_position = 8;
+  void clear_accelerator_pedal_position();
+  ::PROTOBUF_NAMESPACE_ID::uint32 accelerator_pedal_position() const;
+  void set_accelerator_pedal_position(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_accelerator_pedal_position() const;
+  void _internal_set_accelerator_pedal_position(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 brake_pedal_position = 9;
+  void clear_brake_pedal_position();
+  ::PROTOBUF_NAMESPACE_ID::uint32 brake_pedal_position() const;
+  void set_brake_pedal_position(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_brake_pedal_position() const;
+  void _internal_set_brake_pedal_position(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tbox.mcu.rsms.v2.FastData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > motor_state_;
+  mutable std::atomic<int> _motor_state_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > motor_controller_temperature_;
+  mutable std::atomic<int> _motor_controller_temperature_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > motor_speed_;
+  mutable std::atomic<int> _motor_speed_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > motor_torque_;
+  mutable std::atomic<int> _motor_torque_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > motor_temperature_;
+  mutable std::atomic<int> _motor_temperature_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > motor_controller_input_voltage_;
+  mutable std::atomic<int> _motor_controller_input_voltage_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > motor_controller_dc_bus_current_;
+  mutable std::atomic<int> _motor_controller_dc_bus_current_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 speed_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 total_voltage_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 total_current_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 soc_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 gear_;
+  bool driving_;
+  bool braking_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 accelerator_pedal_position_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 brake_pedal_position_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_rsms_5fdata_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PositionData PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tbox.mcu.rsms.v2.PositionData) */ {
+ public:
+  inline PositionData() : PositionData(nullptr) {};
+  virtual ~PositionData();
+
+  PositionData(const PositionData& from);
+  PositionData(PositionData&& from) noexcept
+    : PositionData() {
+    *this = ::std::move(from);
+  }
+
+  inline PositionData& operator=(const PositionData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PositionData& operator=(PositionData&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const PositionData& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PositionData* internal_default_instance() {
+    return reinterpret_cast<const PositionData*>(
+               &_PositionData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(PositionData& a, PositionData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PositionData* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PositionData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PositionData* New() const final {
+    return CreateMaybeMessage<PositionData>(nullptr);
+  }
+
+  PositionData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PositionData>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PositionData& from);
+  void MergeFrom(const PositionData& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PositionData* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tbox.mcu.rsms.v2.PositionData";
+  }
+  protected:
+  explicit PositionData(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_rsms_5fdata_5fv2_2eproto);
+    return ::descriptor_table_rsms_5fdata_5fv2_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStateFieldNumber = 1,
+    kLongitudeFieldNumber = 2,
+    kLatitudeFieldNumber = 3,
+  };
+  // uint32 state = 1;
+  void clear_state();
+  ::PROTOBUF_NAMESPACE_ID::uint32 state() const;
+  void set_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_state() const;
+  void _internal_set_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // fixed32 longitude = 2;
+  void clear_longitude();
+  ::PROTOBUF_NAMESPACE_ID::uint32 longitude() const;
+  void set_longitude(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_longitude() const;
+  void _internal_set_longitude(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // fixed32 latitude = 3;
+  void clear_latitude();
+  ::PROTOBUF_NAMESPACE_ID::uint32 latitude() const;
+  void set_latitude(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_latitude() const;
+  void _internal_set_latitude(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tbox.mcu.rsms.v2.PositionData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 state_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 longitude_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 latitude_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_rsms_5fdata_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CellData PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tbox.mcu.rsms.v2.CellData) */ {
+ public:
+  inline CellData() : CellData(nullptr) {};
+  virtual ~CellData();
+
+  CellData(const CellData& from);
+  CellData(CellData&& from) noexcept
+    : CellData() {
+    *this = ::std::move(from);
+  }
+
+  inline CellData& operator=(const CellData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CellData& operator=(CellData&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const CellData& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const CellData* internal_default_instance() {
+    return reinterpret_cast<const CellData*>(
+               &_CellData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CellData& a, CellData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CellData* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CellData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CellData* New() const final {
+    return CreateMaybeMessage<CellData>(nullptr);
+  }
+
+  CellData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<CellData>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const CellData& from);
+  void MergeFrom(const CellData& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CellData* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tbox.mcu.rsms.v2.CellData";
+  }
+  protected:
+  explicit CellData(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_rsms_5fdata_5fv2_2eproto);
+    return ::descriptor_table_rsms_5fdata_5fv2_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCellVoltagesFieldNumber = 6,
+    kSnFieldNumber = 1,
+    kVoltageFieldNumber = 2,
+    kCurrentFieldNumber = 3,
+    kCellCountFieldNumber = 4,
+    kFrameStartCellSnFieldNumber = 5,
+  };
+  // bytes cell_voltages = 6;
+  void clear_cell_voltages();
+  const std::string& cell_voltages() const;
+  void set_cell_voltages(const std::string& value);
+  void set_cell_voltages(std::string&& value);
+  void set_cell_voltages(const char* value);
+  void set_cell_voltages(const void* value, size_t size);
+  std::string* mutable_cell_voltages();
+  std::string* release_cell_voltages();
+  void set_allocated_cell_voltages(std::string* cell_voltages);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_cell_voltages();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_cell_voltages(
+      std::string* cell_voltages);
+  private:
+  const std::string& _internal_cell_voltages() const;
+  void _internal_set_cell_voltages(const std::string& value);
+  std::string* _internal_mutable_cell_voltages();
+  public:
+
+  // uint32 sn = 1;
+  void clear_sn();
+  ::PROTOBUF_NAMESPACE_ID::uint32 sn() const;
+  void set_sn(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_sn() const;
+  void _internal_set_sn(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 voltage = 2;
+  void clear_voltage();
+  ::PROTOBUF_NAMESPACE_ID::uint32 voltage() const;
+  void set_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_voltage() const;
+  void _internal_set_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 current = 3;
+  void clear_current();
+  ::PROTOBUF_NAMESPACE_ID::uint32 current() const;
+  void set_current(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_current() const;
+  void _internal_set_current(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 cell_count = 4;
+  void clear_cell_count();
+  ::PROTOBUF_NAMESPACE_ID::uint32 cell_count() const;
+  void set_cell_count(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_cell_count() const;
+  void _internal_set_cell_count(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 frame_start_cell_sn = 5;
+  void clear_frame_start_cell_sn();
+  ::PROTOBUF_NAMESPACE_ID::uint32 frame_start_cell_sn() const;
+  void set_frame_start_cell_sn(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_frame_start_cell_sn() const;
+  void _internal_set_frame_start_cell_sn(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tbox.mcu.rsms.v2.CellData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cell_voltages_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 sn_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 voltage_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 current_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 cell_count_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 frame_start_cell_sn_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_rsms_5fdata_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SlowData PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tbox.mcu.rsms.v2.SlowData) */ {
+ public:
+  inline SlowData() : SlowData(nullptr) {};
+  virtual ~SlowData();
+
+  SlowData(const SlowData& from);
+  SlowData(SlowData&& from) noexcept
+    : SlowData() {
+    *this = ::std::move(from);
+  }
+
+  inline SlowData& operator=(const SlowData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SlowData& operator=(SlowData&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SlowData& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SlowData* internal_default_instance() {
+    return reinterpret_cast<const SlowData*>(
+               &_SlowData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SlowData& a, SlowData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SlowData* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SlowData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SlowData* New() const final {
+    return CreateMaybeMessage<SlowData>(nullptr);
+  }
+
+  SlowData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SlowData>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SlowData& from);
+  void MergeFrom(const SlowData& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SlowData* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tbox.mcu.rsms.v2.SlowData";
+  }
+  protected:
+  explicit SlowData(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_rsms_5fdata_5fv2_2eproto);
+    return ::descriptor_table_rsms_5fdata_5fv2_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExtremumFieldNumber = 9,
+    kBatteryFaultListFieldNumber = 12,
+    kDriveMotorFaultListFieldNumber = 13,
+    kEngineFaultListFieldNumber = 14,
+    kOtherFaultListFieldNumber = 15,
+    kProbeTemperaturesFieldNumber = 8,
+    kVehicleStateFieldNumber = 1,
+    kChargingStateFieldNumber = 2,
+    kRunningModeFieldNumber = 3,
+    kTotalOdometerFieldNumber = 4,
+    kDcdcStateFieldNumber = 5,
+    kInsulationResistanceFieldNumber = 6,
+    kBatterySnFieldNumber = 7,
+    kMaxAlarmLevelFieldNumber = 10,
+    kAlarmFlagFieldNumber = 11,
+  };
+  // repeated uint32 extremum = 9;
+  int extremum_size() const;
+  private:
+  int _internal_extremum_size() const;
+  public:
+  void clear_extremum();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_extremum(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_extremum() const;
+  void _internal_add_extremum(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_extremum();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 extremum(int index) const;
+  void set_extremum(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_extremum(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      extremum() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_extremum();
+
+  // repeated fixed32 battery_fault_list = 12;
+  int battery_fault_list_size() const;
+  private:
+  int _internal_battery_fault_list_size() const;
+  public:
+  void clear_battery_fault_list();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_battery_fault_list(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_battery_fault_list() const;
+  void _internal_add_battery_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_battery_fault_list();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 battery_fault_list(int index) const;
+  void set_battery_fault_list(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_battery_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      battery_fault_list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_battery_fault_list();
+
+  // repeated fixed32 drive_motor_fault_list = 13;
+  int drive_motor_fault_list_size() const;
+  private:
+  int _internal_drive_motor_fault_list_size() const;
+  public:
+  void clear_drive_motor_fault_list();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_drive_motor_fault_list(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_drive_motor_fault_list() const;
+  void _internal_add_drive_motor_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_drive_motor_fault_list();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 drive_motor_fault_list(int index) const;
+  void set_drive_motor_fault_list(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_drive_motor_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      drive_motor_fault_list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_drive_motor_fault_list();
+
+  // repeated fixed32 engine_fault_list = 14;
+  int engine_fault_list_size() const;
+  private:
+  int _internal_engine_fault_list_size() const;
+  public:
+  void clear_engine_fault_list();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_engine_fault_list(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_engine_fault_list() const;
+  void _internal_add_engine_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_engine_fault_list();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 engine_fault_list(int index) const;
+  void set_engine_fault_list(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_engine_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      engine_fault_list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_engine_fault_list();
+
+  // repeated fixed32 other_fault_list = 15;
+  int other_fault_list_size() const;
+  private:
+  int _internal_other_fault_list_size() const;
+  public:
+  void clear_other_fault_list();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_other_fault_list(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_other_fault_list() const;
+  void _internal_add_other_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_other_fault_list();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 other_fault_list(int index) const;
+  void set_other_fault_list(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_other_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      other_fault_list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_other_fault_list();
+
+  // bytes probe_temperatures = 8;
+  void clear_probe_temperatures();
+  const std::string& probe_temperatures() const;
+  void set_probe_temperatures(const std::string& value);
+  void set_probe_temperatures(std::string&& value);
+  void set_probe_temperatures(const char* value);
+  void set_probe_temperatures(const void* value, size_t size);
+  std::string* mutable_probe_temperatures();
+  std::string* release_probe_temperatures();
+  void set_allocated_probe_temperatures(std::string* probe_temperatures);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_probe_temperatures();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_probe_temperatures(
+      std::string* probe_temperatures);
+  private:
+  const std::string& _internal_probe_temperatures() const;
+  void _internal_set_probe_temperatures(const std::string& value);
+  std::string* _internal_mutable_probe_temperatures();
+  public:
+
+  // uint32 vehicle_state = 1;
+  void clear_vehicle_state();
+  ::PROTOBUF_NAMESPACE_ID::uint32 vehicle_state() const;
+  void set_vehicle_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_vehicle_state() const;
+  void _internal_set_vehicle_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 charging_state = 2;
+  void clear_charging_state();
+  ::PROTOBUF_NAMESPACE_ID::uint32 charging_state() const;
+  void set_charging_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_charging_state() const;
+  void _internal_set_charging_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 running_mode = 3;
+  void clear_running_mode();
+  ::PROTOBUF_NAMESPACE_ID::uint32 running_mode() const;
+  void set_running_mode(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_running_mode() const;
+  void _internal_set_running_mode(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 total_odometer = 4;
+  void clear_total_odometer();
+  ::PROTOBUF_NAMESPACE_ID::uint32 total_odometer() const;
+  void set_total_odometer(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_total_odometer() const;
+  void _internal_set_total_odometer(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 dcdc_state = 5;
+  void clear_dcdc_state();
+  ::PROTOBUF_NAMESPACE_ID::uint32 dcdc_state() const;
+  void set_dcdc_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_dcdc_state() const;
+  void _internal_set_dcdc_state(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 insulation_resistance = 6;
+  void clear_insulation_resistance();
+  ::PROTOBUF_NAMESPACE_ID::uint32 insulation_resistance() const;
+  void set_insulation_resistance(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_insulation_resistance() const;
+  void _internal_set_insulation_resistance(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 battery_sn = 7;
+  void clear_battery_sn();
+  ::PROTOBUF_NAMESPACE_ID::uint32 battery_sn() const;
+  void set_battery_sn(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_battery_sn() const;
+  void _internal_set_battery_sn(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 max_alarm_level = 10;
+  void clear_max_alarm_level();
+  ::PROTOBUF_NAMESPACE_ID::uint32 max_alarm_level() const;
+  void set_max_alarm_level(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_max_alarm_level() const;
+  void _internal_set_max_alarm_level(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // fixed32 alarm_flag = 11;
+  void clear_alarm_flag();
+  ::PROTOBUF_NAMESPACE_ID::uint32 alarm_flag() const;
+  void set_alarm_flag(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_alarm_flag() const;
+  void _internal_set_alarm_flag(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tbox.mcu.rsms.v2.SlowData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > extremum_;
+  mutable std::atomic<int> _extremum_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > battery_fault_list_;
+  mutable std::atomic<int> _battery_fault_list_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > drive_motor_fault_list_;
+  mutable std::atomic<int> _drive_motor_fault_list_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > engine_fault_list_;
+  mutable std::atomic<int> _engine_fault_list_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > other_fault_list_;
+  mutable std::atomic<int> _other_fault_list_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr probe_temperatures_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 vehicle_state_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 charging_state_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 running_mode_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 total_odometer_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 dcdc_state_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 insulation_resistance_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 battery_sn_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 max_alarm_level_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 alarm_flag_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_rsms_5fdata_5fv2_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RsmsDelta
+
+// uint32 sequence = 1;
+inline void RsmsDelta::clear_sequence() {
+  sequence_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 RsmsDelta::_internal_sequence() const {
+  return sequence_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 RsmsDelta::sequence() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.RsmsDelta.sequence)
+  return _internal_sequence();
+}
+inline void RsmsDelta::_internal_set_sequence(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  sequence_ = value;
+}
+inline void RsmsDelta::set_sequence(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.RsmsDelta.sequence)
+}
+
+// bool keyframe = 2;
+inline void RsmsDelta::clear_keyframe() {
+  keyframe_ = false;
+}
+inline bool RsmsDelta::_internal_keyframe() const {
+  return keyframe_;
+}
+inline bool RsmsDelta::keyframe() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.RsmsDelta.keyframe)
+  return _internal_keyframe();
+}
+inline void RsmsDelta::_internal_set_keyframe(bool value) {
+  
+  keyframe_ = value;
+}
+inline void RsmsDelta::set_keyframe(bool value) {
+  _internal_set_keyframe(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.RsmsDelta.keyframe)
+}
+
+// repeated fixed64 presence = 3;
+inline int RsmsDelta::_internal_presence_size() const {
+  return presence_.size();
+}
+inline int RsmsDelta::presence_size() const {
+  return _internal_presence_size();
+}
+inline void RsmsDelta::clear_presence() {
+  presence_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RsmsDelta::_internal_presence(int index) const {
+  return presence_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RsmsDelta::presence(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.RsmsDelta.presence)
+  return _internal_presence(index);
+}
+inline void RsmsDelta::set_presence(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  presence_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.RsmsDelta.presence)
+}
+inline void RsmsDelta::_internal_add_presence(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  presence_.Add(value);
+}
+inline void RsmsDelta::add_presence(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_presence(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.RsmsDelta.presence)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+RsmsDelta::_internal_presence() const {
+  return presence_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+RsmsDelta::presence() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.RsmsDelta.presence)
+  return _internal_presence();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+RsmsDelta::_internal_mutable_presence() {
+  return &presence_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+RsmsDelta::mutable_presence() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.RsmsDelta.presence)
+  return _internal_mutable_presence();
+}
+
+// repeated uint32 values = 4;
+inline int RsmsDelta::_internal_values_size() const {
+  return values_.size();
+}
+inline int RsmsDelta::values_size() const {
+  return _internal_values_size();
+}
+inline void RsmsDelta::clear_values() {
+  values_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 RsmsDelta::_internal_values(int index) const {
+  return values_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 RsmsDelta::values(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.RsmsDelta.values)
+  return _internal_values(index);
+}
+inline void RsmsDelta::set_values(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.RsmsDelta.values)
+}
+inline void RsmsDelta::_internal_add_values(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  values_.Add(value);
+}
+inline void RsmsDelta::add_values(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_values(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.RsmsDelta.values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+RsmsDelta::_internal_values() const {
+  return values_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+RsmsDelta::values() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.RsmsDelta.values)
+  return _internal_values();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+RsmsDelta::_internal_mutable_values() {
+  return &values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+RsmsDelta::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.RsmsDelta.values)
+  return _internal_mutable_values();
+}
+
+// -------------------------------------------------------------------
+
+// FastData
+
+// uint32 speed = 1;
+inline void FastData::clear_speed() {
+  speed_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_speed() const {
+  return speed_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::speed() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.speed)
+  return _internal_speed();
+}
+inline void FastData::_internal_set_speed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  speed_ = value;
+}
+inline void FastData::set_speed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.speed)
+}
+
+// uint32 total_voltage = 2;
+inline void FastData::clear_total_voltage() {
+  total_voltage_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_total_voltage() const {
+  return total_voltage_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::total_voltage() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.total_voltage)
+  return _internal_total_voltage();
+}
+inline void FastData::_internal_set_total_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  total_voltage_ = value;
+}
+inline void FastData::set_total_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_total_voltage(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.total_voltage)
+}
+
+// uint32 total_current = 3;
+inline void FastData::clear_total_current() {
+  total_current_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_total_current() const {
+  return total_current_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::total_current() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.total_current)
+  return _internal_total_current();
+}
+inline void FastData::_internal_set_total_current(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  total_current_ = value;
+}
+inline void FastData::set_total_current(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_total_current(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.total_current)
+}
+
+// uint32 soc = 4;
+inline void FastData::clear_soc() {
+  soc_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_soc() const {
+  return soc_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::soc() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.soc)
+  return _internal_soc();
+}
+inline void FastData::_internal_set_soc(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  soc_ = value;
+}
+inline void FastData::set_soc(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_soc(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.soc)
+}
+
+// uint32 gear = 5;
+inline void FastData::clear_gear() {
+  gear_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_gear() const {
+  return gear_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::gear() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.gear)
+  return _internal_gear();
+}
+inline void FastData::_internal_set_gear(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  gear_ = value;
+}
+inline void FastData::set_gear(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_gear(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.gear)
+}
+
+// bool driving = 6;
+inline void FastData::clear_driving() {
+  driving_ = false;
+}
+inline bool FastData::_internal_driving() const {
+  return driving_;
+}
+inline bool FastData::driving() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.driving)
+  return _internal_driving();
+}
+inline void FastData::_internal_set_driving(bool value) {
+  
+  driving_ = value;
+}
+inline void FastData::set_driving(bool value) {
+  _internal_set_driving(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.driving)
+}
+
+// bool braking = 7;
+inline void FastData::clear_braking() {
+  braking_ = false;
+}
+inline bool FastData::_internal_braking() const {
+  return braking_;
+}
+inline bool FastData::braking() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.braking)
+  return _internal_braking();
+}
+inline void FastData::_internal_set_braking(bool value) {
+  
+  braking_ = value;
+}
+inline void FastData::set_braking(bool value) {
+  _internal_set_braking(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.braking)
+}
+
+// uint32 accelerator_pedal_position = 8;
+inline void FastData::clear_accelerator_pedal_position() {
+  accelerator_pedal_position_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_accelerator_pedal_position() const {
+  return accelerator_pedal_position_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::accelerator_pedal_position() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.accelerator_pedal_position)
+  return _internal_accelerator_pedal_position();
+}
+inline void FastData::_internal_set_accelerator_pedal_position(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  accelerator_pedal_position_ = value;
+}
+inline void FastData::set_accelerator_pedal_position(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_accelerator_pedal_position(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.accelerator_pedal_position)
+}
+
+// uint32 brake_pedal_position = 9;
+inline void FastData::clear_brake_pedal_position() {
+  brake_pedal_position_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_brake_pedal_position() const {
+  return brake_pedal_position_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::brake_pedal_position() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.brake_pedal_position)
+  return _internal_brake_pedal_position();
+}
+inline void FastData::_internal_set_brake_pedal_position(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  brake_pedal_position_ = value;
+}
+inline void FastData::set_brake_pedal_position(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_brake_pedal_position(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.brake_pedal_position)
+}
+
+// repeated uint32 motor_state = 10;
+inline int FastData::_internal_motor_state_size() const {
+  return motor_state_.size();
+}
+inline int FastData::motor_state_size() const {
+  return _internal_motor_state_size();
+}
+inline void FastData::clear_motor_state() {
+  motor_state_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_motor_state(int index) const {
+  return motor_state_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::motor_state(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.motor_state)
+  return _internal_motor_state(index);
+}
+inline void FastData::set_motor_state(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_state_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.motor_state)
+}
+inline void FastData::_internal_add_motor_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_state_.Add(value);
+}
+inline void FastData::add_motor_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_motor_state(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.FastData.motor_state)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::_internal_motor_state() const {
+  return motor_state_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::motor_state() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.FastData.motor_state)
+  return _internal_motor_state();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::_internal_mutable_motor_state() {
+  return &motor_state_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::mutable_motor_state() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.FastData.motor_state)
+  return _internal_mutable_motor_state();
+}
+
+// repeated uint32 motor_controller_temperature = 11;
+inline int FastData::_internal_motor_controller_temperature_size() const {
+  return motor_controller_temperature_.size();
+}
+inline int FastData::motor_controller_temperature_size() const {
+  return _internal_motor_controller_temperature_size();
+}
+inline void FastData::clear_motor_controller_temperature() {
+  motor_controller_temperature_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_motor_controller_temperature(int index) const {
+  return motor_controller_temperature_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::motor_controller_temperature(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.motor_controller_temperature)
+  return _internal_motor_controller_temperature(index);
+}
+inline void FastData::set_motor_controller_temperature(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_controller_temperature_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.motor_controller_temperature)
+}
+inline void FastData::_internal_add_motor_controller_temperature(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_controller_temperature_.Add(value);
+}
+inline void FastData::add_motor_controller_temperature(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_motor_controller_temperature(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.FastData.motor_controller_temperature)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::_internal_motor_controller_temperature() const {
+  return motor_controller_temperature_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::motor_controller_temperature() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.FastData.motor_controller_temperature)
+  return _internal_motor_controller_temperature();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::_internal_mutable_motor_controller_temperature() {
+  return &motor_controller_temperature_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::mutable_motor_controller_temperature() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.FastData.motor_controller_temperature)
+  return _internal_mutable_motor_controller_temperature();
+}
+
+// repeated uint32 motor_speed = 12;
+inline int FastData::_internal_motor_speed_size() const {
+  return motor_speed_.size();
+}
+inline int FastData::motor_speed_size() const {
+  return _internal_motor_speed_size();
+}
+inline void FastData::clear_motor_speed() {
+  motor_speed_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_motor_speed(int index) const {
+  return motor_speed_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::motor_speed(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.motor_speed)
+  return _internal_motor_speed(index);
+}
+inline void FastData::set_motor_speed(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_speed_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.motor_speed)
+}
+inline void FastData::_internal_add_motor_speed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_speed_.Add(value);
+}
+inline void FastData::add_motor_speed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_motor_speed(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.FastData.motor_speed)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::_internal_motor_speed() const {
+  return motor_speed_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::motor_speed() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.FastData.motor_speed)
+  return _internal_motor_speed();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::_internal_mutable_motor_speed() {
+  return &motor_speed_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::mutable_motor_speed() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.FastData.motor_speed)
+  return _internal_mutable_motor_speed();
+}
+
+// repeated uint32 motor_torque = 13;
+inline int FastData::_internal_motor_torque_size() const {
+  return motor_torque_.size();
+}
+inline int FastData::motor_torque_size() const {
+  return _internal_motor_torque_size();
+}
+inline void FastData::clear_motor_torque() {
+  motor_torque_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_motor_torque(int index) const {
+  return motor_torque_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::motor_torque(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.motor_torque)
+  return _internal_motor_torque(index);
+}
+inline void FastData::set_motor_torque(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_torque_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.motor_torque)
+}
+inline void FastData::_internal_add_motor_torque(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_torque_.Add(value);
+}
+inline void FastData::add_motor_torque(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_motor_torque(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.FastData.motor_torque)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::_internal_motor_torque() const {
+  return motor_torque_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::motor_torque() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.FastData.motor_torque)
+  return _internal_motor_torque();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::_internal_mutable_motor_torque() {
+  return &motor_torque_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::mutable_motor_torque() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.FastData.motor_torque)
+  return _internal_mutable_motor_torque();
+}
+
+// repeated uint32 motor_temperature = 14;
+inline int FastData::_internal_motor_temperature_size() const {
+  return motor_temperature_.size();
+}
+inline int FastData::motor_temperature_size() const {
+  return _internal_motor_temperature_size();
+}
+inline void FastData::clear_motor_temperature() {
+  motor_temperature_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_motor_temperature(int index) const {
+  return motor_temperature_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::motor_temperature(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.motor_temperature)
+  return _internal_motor_temperature(index);
+}
+inline void FastData::set_motor_temperature(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_temperature_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.motor_temperature)
+}
+inline void FastData::_internal_add_motor_temperature(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_temperature_.Add(value);
+}
+inline void FastData::add_motor_temperature(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_motor_temperature(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.FastData.motor_temperature)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::_internal_motor_temperature() const {
+  return motor_temperature_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::motor_temperature() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.FastData.motor_temperature)
+  return _internal_motor_temperature();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::_internal_mutable_motor_temperature() {
+  return &motor_temperature_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::mutable_motor_temperature() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.FastData.motor_temperature)
+  return _internal_mutable_motor_temperature();
+}
+
+// repeated uint32 motor_controller_input_voltage = 15;
+inline int FastData::_internal_motor_controller_input_voltage_size() const {
+  return motor_controller_input_voltage_.size();
+}
+inline int FastData::motor_controller_input_voltage_size() const {
+  return _internal_motor_controller_input_voltage_size();
+}
+inline void FastData::clear_motor_controller_input_voltage() {
+  motor_controller_input_voltage_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_motor_controller_input_voltage(int index) const {
+  return motor_controller_input_voltage_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::motor_controller_input_voltage(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.motor_controller_input_voltage)
+  return _internal_motor_controller_input_voltage(index);
+}
+inline void FastData::set_motor_controller_input_voltage(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_controller_input_voltage_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.motor_controller_input_voltage)
+}
+inline void FastData::_internal_add_motor_controller_input_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_controller_input_voltage_.Add(value);
+}
+inline void FastData::add_motor_controller_input_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_motor_controller_input_voltage(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.FastData.motor_controller_input_voltage)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::_internal_motor_controller_input_voltage() const {
+  return motor_controller_input_voltage_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::motor_controller_input_voltage() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.FastData.motor_controller_input_voltage)
+  return _internal_motor_controller_input_voltage();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::_internal_mutable_motor_controller_input_voltage() {
+  return &motor_controller_input_voltage_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::mutable_motor_controller_input_voltage() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.FastData.motor_controller_input_voltage)
+  return _internal_mutable_motor_controller_input_voltage();
+}
+
+// repeated uint32 motor_controller_dc_bus_current = 16;
+inline int FastData::_internal_motor_controller_dc_bus_current_size() const {
+  return motor_controller_dc_bus_current_.size();
+}
+inline int FastData::motor_controller_dc_bus_current_size() const {
+  return _internal_motor_controller_dc_bus_current_size();
+}
+inline void FastData::clear_motor_controller_dc_bus_current() {
+  motor_controller_dc_bus_current_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::_internal_motor_controller_dc_bus_current(int index) const {
+  return motor_controller_dc_bus_current_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 FastData::motor_controller_dc_bus_current(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.FastData.motor_controller_dc_bus_current)
+  return _internal_motor_controller_dc_bus_current(index);
+}
+inline void FastData::set_motor_controller_dc_bus_current(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_controller_dc_bus_current_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.FastData.motor_controller_dc_bus_current)
+}
+inline void FastData::_internal_add_motor_controller_dc_bus_current(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  motor_controller_dc_bus_current_.Add(value);
+}
+inline void FastData::add_motor_controller_dc_bus_current(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_motor_controller_dc_bus_current(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.FastData.motor_controller_dc_bus_current)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::_internal_motor_controller_dc_bus_current() const {
+  return motor_controller_dc_bus_current_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+FastData::motor_controller_dc_bus_current() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.FastData.motor_controller_dc_bus_current)
+  return _internal_motor_controller_dc_bus_current();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::_internal_mutable_motor_controller_dc_bus_current() {
+  return &motor_controller_dc_bus_current_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+FastData::mutable_motor_controller_dc_bus_current() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.FastData.motor_controller_dc_bus_current)
+  return _internal_mutable_motor_controller_dc_bus_current();
+}
+
+// -------------------------------------------------------------------
+
+// PositionData
+
+// uint32 state = 1;
+inline void PositionData::clear_state() {
+  state_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PositionData::_internal_state() const {
+  return state_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PositionData::state() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.PositionData.state)
+  return _internal_state();
+}
+inline void PositionData::_internal_set_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  state_ = value;
+}
+inline void PositionData::set_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.PositionData.state)
+}
+
+// fixed32 longitude = 2;
+inline void PositionData::clear_longitude() {
+  longitude_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PositionData::_internal_longitude() const {
+  return longitude_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PositionData::longitude() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.PositionData.longitude)
+  return _internal_longitude();
+}
+inline void PositionData::_internal_set_longitude(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  longitude_ = value;
+}
+inline void PositionData::set_longitude(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_longitude(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.PositionData.longitude)
+}
+
+// fixed32 latitude = 3;
+inline void PositionData::clear_latitude() {
+  latitude_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PositionData::_internal_latitude() const {
+  return latitude_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PositionData::latitude() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.PositionData.latitude)
+  return _internal_latitude();
+}
+inline void PositionData::_internal_set_latitude(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  latitude_ = value;
+}
+inline void PositionData::set_latitude(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_latitude(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.PositionData.latitude)
+}
+
+// -------------------------------------------------------------------
+
+// CellData
+
+// uint32 sn = 1;
+inline void CellData::clear_sn() {
+  sn_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::_internal_sn() const {
+  return sn_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::sn() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.CellData.sn)
+  return _internal_sn();
+}
+inline void CellData::_internal_set_sn(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  sn_ = value;
+}
+inline void CellData::set_sn(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_sn(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.CellData.sn)
+}
+
+// uint32 voltage = 2;
+inline void CellData::clear_voltage() {
+  voltage_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::_internal_voltage() const {
+  return voltage_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::voltage() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.CellData.voltage)
+  return _internal_voltage();
+}
+inline void CellData::_internal_set_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  voltage_ = value;
+}
+inline void CellData::set_voltage(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_voltage(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.CellData.voltage)
+}
+
+// uint32 current = 3;
+inline void CellData::clear_current() {
+  current_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::_internal_current() const {
+  return current_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::current() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.CellData.current)
+  return _internal_current();
+}
+inline void CellData::_internal_set_current(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  current_ = value;
+}
+inline void CellData::set_current(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_current(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.CellData.current)
+}
+
+// uint32 cell_count = 4;
+inline void CellData::clear_cell_count() {
+  cell_count_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::_internal_cell_count() const {
+  return cell_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::cell_count() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.CellData.cell_count)
+  return _internal_cell_count();
+}
+inline void CellData::_internal_set_cell_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  cell_count_ = value;
+}
+inline void CellData::set_cell_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_cell_count(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.CellData.cell_count)
+}
+
+// uint32 frame_start_cell_sn = 5;
+inline void CellData::clear_frame_start_cell_sn() {
+  frame_start_cell_sn_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::_internal_frame_start_cell_sn() const {
+  return frame_start_cell_sn_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CellData::frame_start_cell_sn() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.CellData.frame_start_cell_sn)
+  return _internal_frame_start_cell_sn();
+}
+inline void CellData::_internal_set_frame_start_cell_sn(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  frame_start_cell_sn_ = value;
+}
+inline void CellData::set_frame_start_cell_sn(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_frame_start_cell_sn(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.CellData.frame_start_cell_sn)
+}
+
+// bytes cell_voltages = 6;
+inline void CellData::clear_cell_voltages() {
+  cell_voltages_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& CellData::cell_voltages() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.CellData.cell_voltages)
+  return _internal_cell_voltages();
+}
+inline void CellData::set_cell_voltages(const std::string& value) {
+  _internal_set_cell_voltages(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.CellData.cell_voltages)
+}
+inline std::string* CellData::mutable_cell_voltages() {
+  // @@protoc_insertion_point(field_mutable:tbox.mcu.rsms.v2.CellData.cell_voltages)
+  return _internal_mutable_cell_voltages();
+}
+inline const std::string& CellData::_internal_cell_voltages() const {
+  return cell_voltages_.Get();
+}
+inline void CellData::_internal_set_cell_voltages(const std::string& value) {
+  
+  cell_voltages_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void CellData::set_cell_voltages(std::string&& value) {
+  
+  cell_voltages_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:tbox.mcu.rsms.v2.CellData.cell_voltages)
+}
+inline void CellData::set_cell_voltages(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  cell_voltages_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:tbox.mcu.rsms.v2.CellData.cell_voltages)
+}
+inline void CellData::set_cell_voltages(const void* value,
+    size_t size) {
+  
+  cell_voltages_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:tbox.mcu.rsms.v2.CellData.cell_voltages)
+}
+inline std::string* CellData::_internal_mutable_cell_voltages() {
+  
+  return cell_voltages_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* CellData::release_cell_voltages() {
+  // @@protoc_insertion_point(field_release:tbox.mcu.rsms.v2.CellData.cell_voltages)
+  return cell_voltages_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void CellData::set_allocated_cell_voltages(std::string* cell_voltages) {
+  if (cell_voltages != nullptr) {
+    
+  } else {
+    
+  }
+  cell_voltages_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), cell_voltages,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:tbox.mcu.rsms.v2.CellData.cell_voltages)
+}
+inline std::string* CellData::unsafe_arena_release_cell_voltages() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tbox.mcu.rsms.v2.CellData.cell_voltages)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return cell_voltages_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void CellData::unsafe_arena_set_allocated_cell_voltages(
+    std::string* cell_voltages) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (cell_voltages != nullptr) {
+    
+  } else {
+    
+  }
+  cell_voltages_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      cell_voltages, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tbox.mcu.rsms.v2.CellData.cell_voltages)
+}
+
+// -------------------------------------------------------------------
+
+// SlowData
+
+// uint32 vehicle_state = 1;
+inline void SlowData::clear_vehicle_state() {
+  vehicle_state_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_vehicle_state() const {
+  return vehicle_state_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::vehicle_state() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.vehicle_state)
+  return _internal_vehicle_state();
+}
+inline void SlowData::_internal_set_vehicle_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  vehicle_state_ = value;
+}
+inline void SlowData::set_vehicle_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_vehicle_state(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.vehicle_state)
+}
+
+// uint32 charging_state = 2;
+inline void SlowData::clear_charging_state() {
+  charging_state_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_charging_state() const {
+  return charging_state_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::charging_state() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.charging_state)
+  return _internal_charging_state();
+}
+inline void SlowData::_internal_set_charging_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  charging_state_ = value;
+}
+inline void SlowData::set_charging_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_charging_state(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.charging_state)
+}
+
+// uint32 running_mode = 3;
+inline void SlowData::clear_running_mode() {
+  running_mode_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_running_mode() const {
+  return running_mode_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::running_mode() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.running_mode)
+  return _internal_running_mode();
+}
+inline void SlowData::_internal_set_running_mode(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  running_mode_ = value;
+}
+inline void SlowData::set_running_mode(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_running_mode(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.running_mode)
+}
+
+// uint32 total_odometer = 4;
+inline void SlowData::clear_total_odometer() {
+  total_odometer_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_total_odometer() const {
+  return total_odometer_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::total_odometer() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.total_odometer)
+  return _internal_total_odometer();
+}
+inline void SlowData::_internal_set_total_odometer(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  total_odometer_ = value;
+}
+inline void SlowData::set_total_odometer(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_total_odometer(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.total_odometer)
+}
+
+// uint32 dcdc_state = 5;
+inline void SlowData::clear_dcdc_state() {
+  dcdc_state_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_dcdc_state() const {
+  return dcdc_state_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::dcdc_state() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.dcdc_state)
+  return _internal_dcdc_state();
+}
+inline void SlowData::_internal_set_dcdc_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  dcdc_state_ = value;
+}
+inline void SlowData::set_dcdc_state(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_dcdc_state(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.dcdc_state)
+}
+
+// uint32 insulation_resistance = 6;
+inline void SlowData::clear_insulation_resistance() {
+  insulation_resistance_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_insulation_resistance() const {
+  return insulation_resistance_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::insulation_resistance() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.insulation_resistance)
+  return _internal_insulation_resistance();
+}
+inline void SlowData::_internal_set_insulation_resistance(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  insulation_resistance_ = value;
+}
+inline void SlowData::set_insulation_resistance(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_insulation_resistance(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.insulation_resistance)
+}
+
+// uint32 battery_sn = 7;
+inline void SlowData::clear_battery_sn() {
+  battery_sn_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_battery_sn() const {
+  return battery_sn_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::battery_sn() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.battery_sn)
+  return _internal_battery_sn();
+}
+inline void SlowData::_internal_set_battery_sn(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  battery_sn_ = value;
+}
+inline void SlowData::set_battery_sn(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_battery_sn(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.battery_sn)
+}
+
+// bytes probe_temperatures = 8;
+inline void SlowData::clear_probe_temperatures() {
+  probe_temperatures_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& SlowData::probe_temperatures() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+  return _internal_probe_temperatures();
+}
+inline void SlowData::set_probe_temperatures(const std::string& value) {
+  _internal_set_probe_temperatures(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+}
+inline std::string* SlowData::mutable_probe_temperatures() {
+  // @@protoc_insertion_point(field_mutable:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+  return _internal_mutable_probe_temperatures();
+}
+inline const std::string& SlowData::_internal_probe_temperatures() const {
+  return probe_temperatures_.Get();
+}
+inline void SlowData::_internal_set_probe_temperatures(const std::string& value) {
+  
+  probe_temperatures_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void SlowData::set_probe_temperatures(std::string&& value) {
+  
+  probe_temperatures_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+}
+inline void SlowData::set_probe_temperatures(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  probe_temperatures_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+}
+inline void SlowData::set_probe_temperatures(const void* value,
+    size_t size) {
+  
+  probe_temperatures_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+}
+inline std::string* SlowData::_internal_mutable_probe_temperatures() {
+  
+  return probe_temperatures_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* SlowData::release_probe_temperatures() {
+  // @@protoc_insertion_point(field_release:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+  return probe_temperatures_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SlowData::set_allocated_probe_temperatures(std::string* probe_temperatures) {
+  if (probe_temperatures != nullptr) {
+    
+  } else {
+    
+  }
+  probe_temperatures_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), probe_temperatures,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+}
+inline std::string* SlowData::unsafe_arena_release_probe_temperatures() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return probe_temperatures_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void SlowData::unsafe_arena_set_allocated_probe_temperatures(
+    std::string* probe_temperatures) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (probe_temperatures != nullptr) {
+    
+  } else {
+    
+  }
+  probe_temperatures_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      probe_temperatures, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tbox.mcu.rsms.v2.SlowData.probe_temperatures)
+}
+
+// repeated uint32 extremum = 9;
+inline int SlowData::_internal_extremum_size() const {
+  return extremum_.size();
+}
+inline int SlowData::extremum_size() const {
+  return _internal_extremum_size();
+}
+inline void SlowData::clear_extremum() {
+  extremum_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_extremum(int index) const {
+  return extremum_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::extremum(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.extremum)
+  return _internal_extremum(index);
+}
+inline void SlowData::set_extremum(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  extremum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.extremum)
+}
+inline void SlowData::_internal_add_extremum(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  extremum_.Add(value);
+}
+inline void SlowData::add_extremum(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_extremum(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.SlowData.extremum)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::_internal_extremum() const {
+  return extremum_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::extremum() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.SlowData.extremum)
+  return _internal_extremum();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::_internal_mutable_extremum() {
+  return &extremum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::mutable_extremum() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.SlowData.extremum)
+  return _internal_mutable_extremum();
+}
+
+// uint32 max_alarm_level = 10;
+inline void SlowData::clear_max_alarm_level() {
+  max_alarm_level_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_max_alarm_level() const {
+  return max_alarm_level_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::max_alarm_level() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.max_alarm_level)
+  return _internal_max_alarm_level();
+}
+inline void SlowData::_internal_set_max_alarm_level(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  max_alarm_level_ = value;
+}
+inline void SlowData::set_max_alarm_level(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_max_alarm_level(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.max_alarm_level)
+}
+
+// fixed32 alarm_flag = 11;
+inline void SlowData::clear_alarm_flag() {
+  alarm_flag_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_alarm_flag() const {
+  return alarm_flag_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::alarm_flag() const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.alarm_flag)
+  return _internal_alarm_flag();
+}
+inline void SlowData::_internal_set_alarm_flag(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  alarm_flag_ = value;
+}
+inline void SlowData::set_alarm_flag(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_alarm_flag(value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.alarm_flag)
+}
+
+// repeated fixed32 battery_fault_list = 12;
+inline int SlowData::_internal_battery_fault_list_size() const {
+  return battery_fault_list_.size();
+}
+inline int SlowData::battery_fault_list_size() const {
+  return _internal_battery_fault_list_size();
+}
+inline void SlowData::clear_battery_fault_list() {
+  battery_fault_list_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_battery_fault_list(int index) const {
+  return battery_fault_list_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::battery_fault_list(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.battery_fault_list)
+  return _internal_battery_fault_list(index);
+}
+inline void SlowData::set_battery_fault_list(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  battery_fault_list_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.battery_fault_list)
+}
+inline void SlowData::_internal_add_battery_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  battery_fault_list_.Add(value);
+}
+inline void SlowData::add_battery_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_battery_fault_list(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.SlowData.battery_fault_list)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::_internal_battery_fault_list() const {
+  return battery_fault_list_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::battery_fault_list() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.SlowData.battery_fault_list)
+  return _internal_battery_fault_list();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::_internal_mutable_battery_fault_list() {
+  return &battery_fault_list_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::mutable_battery_fault_list() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.SlowData.battery_fault_list)
+  return _internal_mutable_battery_fault_list();
+}
+
+// repeated fixed32 drive_motor_fault_list = 13;
+inline int SlowData::_internal_drive_motor_fault_list_size() const {
+  return drive_motor_fault_list_.size();
+}
+inline int SlowData::drive_motor_fault_list_size() const {
+  return _internal_drive_motor_fault_list_size();
+}
+inline void SlowData::clear_drive_motor_fault_list() {
+  drive_motor_fault_list_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_drive_motor_fault_list(int index) const {
+  return drive_motor_fault_list_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::drive_motor_fault_list(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.drive_motor_fault_list)
+  return _internal_drive_motor_fault_list(index);
+}
+inline void SlowData::set_drive_motor_fault_list(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  drive_motor_fault_list_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.drive_motor_fault_list)
+}
+inline void SlowData::_internal_add_drive_motor_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  drive_motor_fault_list_.Add(value);
+}
+inline void SlowData::add_drive_motor_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_drive_motor_fault_list(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.SlowData.drive_motor_fault_list)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::_internal_drive_motor_fault_list() const {
+  return drive_motor_fault_list_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::drive_motor_fault_list() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.SlowData.drive_motor_fault_list)
+  return _internal_drive_motor_fault_list();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::_internal_mutable_drive_motor_fault_list() {
+  return &drive_motor_fault_list_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::mutable_drive_motor_fault_list() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.SlowData.drive_motor_fault_list)
+  return _internal_mutable_drive_motor_fault_list();
+}
+
+// repeated fixed32 engine_fault_list = 14;
+inline int SlowData::_internal_engine_fault_list_size() const {
+  return engine_fault_list_.size();
+}
+inline int SlowData::engine_fault_list_size() const {
+  return _internal_engine_fault_list_size();
+}
+inline void SlowData::clear_engine_fault_list() {
+  engine_fault_list_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_engine_fault_list(int index) const {
+  return engine_fault_list_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::engine_fault_list(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.engine_fault_list)
+  return _internal_engine_fault_list(index);
+}
+inline void SlowData::set_engine_fault_list(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  engine_fault_list_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.engine_fault_list)
+}
+inline void SlowData::_internal_add_engine_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  engine_fault_list_.Add(value);
+}
+inline void SlowData::add_engine_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_engine_fault_list(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.SlowData.engine_fault_list)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::_internal_engine_fault_list() const {
+  return engine_fault_list_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::engine_fault_list() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.SlowData.engine_fault_list)
+  return _internal_engine_fault_list();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::_internal_mutable_engine_fault_list() {
+  return &engine_fault_list_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::mutable_engine_fault_list() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.SlowData.engine_fault_list)
+  return _internal_mutable_engine_fault_list();
+}
+
+// repeated fixed32 other_fault_list = 15;
+inline int SlowData::_internal_other_fault_list_size() const {
+  return other_fault_list_.size();
+}
+inline int SlowData::other_fault_list_size() const {
+  return _internal_other_fault_list_size();
+}
+inline void SlowData::clear_other_fault_list() {
+  other_fault_list_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::_internal_other_fault_list(int index) const {
+  return other_fault_list_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SlowData::other_fault_list(int index) const {
+  // @@protoc_insertion_point(field_get:tbox.mcu.rsms.v2.SlowData.other_fault_list)
+  return _internal_other_fault_list(index);
+}
+inline void SlowData::set_other_fault_list(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  other_fault_list_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tbox.mcu.rsms.v2.SlowData.other_fault_list)
+}
+inline void SlowData::_internal_add_other_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  other_fault_list_.Add(value);
+}
+inline void SlowData::add_other_fault_list(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_other_fault_list(value);
+  // @@protoc_insertion_point(field_add:tbox.mcu.rsms.v2.SlowData.other_fault_list)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::_internal_other_fault_list() const {
+  return other_fault_list_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+SlowData::other_fault_list() const {
+  // @@protoc_insertion_point(field_list:tbox.mcu.rsms.v2.SlowData.other_fault_list)
+  return _internal_other_fault_list();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::_internal_mutable_other_fault_list() {
+  return &other_fault_list_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+SlowData::mutable_other_fault_list() {
+  // @@protoc_insertion_point(field_mutable_list:tbox.mcu.rsms.v2.SlowData.other_fault_list)
+  return _internal_mutable_other_fault_list();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace v2
+}  // namespace rsms
+}  // namespace mcu
+}  // namespace tbox
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rsms_5fdata_5fv2_2eproto
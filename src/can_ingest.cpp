@@ -0,0 +1,324 @@
+//
+// Created by hwyz_leo on 2025/8/27.
+//
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "spdlog/spdlog.h"
+
+#include "can_ingest.h"
+
+namespace {
+// 标准帧ID掩码
+const uint32_t kCanStandardMask = 0x7FFU;
+// 扩展帧ID掩码
+const uint32_t kCanExtendedMask = 0x1FFFFFFFU;
+}
+
+CanIngest &CanIngest::get_instance() {
+    static CanIngest instance;
+    return instance;
+}
+
+bool CanIngest::load_config(const YAML::Node &config) {
+    spdlog::info("加载CAN报文采集配置信息");
+    if (!config["can"]) {
+        return true;
+    }
+    const YAML::Node &can = config["can"];
+    if (can["enable"]) {
+        is_enabled_ = can["enable"].as<bool>();
+    }
+    if (can["interface"]) {
+        interface_ = can["interface"].as<std::string>();
+    }
+    if (can["replay-file"]) {
+        replay_file_ = can["replay-file"].as<std::string>();
+    }
+    if (can["replay-realtime"]) {
+        replay_realtime_ = can["replay-realtime"].as<bool>();
+    }
+    frame_plans_.clear();
+    if (can["signals"]) {
+        try {
+            for (const auto &signal: can["signals"]) {
+                can_signal_plan_t plan{};
+                if (!compile_signal(signal, plan)) {
+                    return false;
+                }
+                uint32_t can_id = static_cast<uint32_t>(std::stoul(signal["id"].as<std::string>(), nullptr, 0));
+                if (can_id > kCanExtendedMask) {
+                    spdlog::error("CAN ID[{}]无效", signal["id"].as<std::string>());
+                    return false;
+                }
+                // 超过11位的为扩展帧
+                frame_plans_[can_id > kCanStandardMask ? can_id | kCanExtendedFlag : can_id].push_back(plan);
+            }
+        } catch (const std::exception &e) {
+            spdlog::error("解析CAN信号配置失败[{}]", e.what());
+            return false;
+        }
+    }
+    spdlog::info("CAN报文采集[{}]报文[{}]个", is_enabled_ ? "启用" : "禁用", frame_plans_.size());
+    return true;
+}
+
+bool CanIngest::start() {
+    if (!is_enabled_ || is_started_) {
+        return is_started_;
+    }
+    if (frame_plans_.empty()) {
+        spdlog::warn("未配置CAN信号，不启动CAN报文采集");
+        return false;
+    }
+    spdlog::info("启动CAN报文采集");
+    is_started_ = true;
+    if (replay_file_.empty()) {
+        ingest_thread_ = std::thread(&CanIngest::socket_thread, this);
+    } else {
+        ingest_thread_ = std::thread(&CanIngest::replay_thread, this);
+    }
+    return true;
+}
+
+void CanIngest::stop() {
+    if (!is_started_) {
+        return;
+    }
+    spdlog::info("停止CAN报文采集，共解析报文[{}]帧", frame_count_.load());
+    is_started_ = false;
+    if (ingest_thread_.joinable()) {
+        ingest_thread_.join();
+    }
+}
+
+bool CanIngest::decode_frame(uint32_t can_id, const uint8_t *data, uint8_t length) {
+    auto it = frame_plans_.find(can_id);
+    if (it == frame_plans_.end()) {
+        return false;
+    }
+    uint8_t bytes[8] = {0};
+    std::memcpy(bytes, data, length > 8 ? 8 : length);
+    uint64_t little_endian = 0;
+    uint64_t big_endian = 0;
+    for (int i = 0; i < 8; i++) {
+        little_endian |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+        big_endian = (big_endian << 8) | bytes[i];
+    }
+    RsmsSignalCache &instance = RsmsSignalCache::get_instance();
+    for (const auto &plan: it->second) {
+        uint64_t raw = ((plan.big_endian ? big_endian : little_endian) >> plan.shift) & plan.mask;
+        double physical;
+        if (plan.is_signed && (raw >> (plan.length - 1)) & 0x01) {
+            physical = static_cast<double>(static_cast<int64_t>(raw | ~plan.mask)) * plan.factor + plan.offset;
+        } else {
+            physical = static_cast<double>(raw) * plan.factor + plan.offset;
+        }
+        double max_value = plan.type == SIGNAL_TYPE_DWORD ? 4294967295.0 :
+                           plan.type == SIGNAL_TYPE_WORD ? 65535.0 : 255.0;
+        physical = std::round(physical);
+        if (physical < 0) {
+            physical = 0;
+        } else if (physical > max_value) {
+            physical = max_value;
+        }
+        instance.set_value(plan.key, plan.type, static_cast<uint32_t>(physical));
+    }
+    frame_count_++;
+    return true;
+}
+
+bool CanIngest::compile_signal(const YAML::Node &signal, can_signal_plan_t &out_plan) {
+    if (!signal["id"] || !signal["signal"] || !signal["start-bit"] || !signal["length"]) {
+        spdlog::error("CAN信号配置缺少id/signal/start-bit/length");
+        return false;
+    }
+    int key = signal["signal"].as<int>();
+    const signal_define_t *define = nullptr;
+    for (size_t i = 0; i < kSignalDefineCount; i++) {
+        if (kSignalDefines[i].key == key) {
+            define = &kSignalDefines[i];
+            break;
+        }
+    }
+    if (define == nullptr) {
+        spdlog::error("CAN信号[{}]不在信号定义表中", key);
+        return false;
+    }
+    int start_bit = signal["start-bit"].as<int>();
+    int length = signal["length"].as<int>();
+    bool big_endian = signal["byte-order"] && signal["byte-order"].as<std::string>() == "motorola";
+    if (start_bit < 0 || start_bit > 63 || length < 1 || length > 32) {
+        spdlog::error("CAN信号[{}]起始位[{}]长度[{}]无效", key, start_bit, length);
+        return false;
+    }
+    int shift;
+    if (big_endian) {
+        // Motorola起始位为最高位，换算为按大端64位整形读取时最低位的右移位数
+        int msb = (start_bit / 8) * 8 + (7 - start_bit % 8);
+        shift = 63 - (msb + length - 1);
+    } else {
+        shift = start_bit;
+        if (start_bit + length > 64) {
+            shift = -1;
+        }
+    }
+    if (shift < 0) {
+        spdlog::error("CAN信号[{}]超出报文范围", key);
+        return false;
+    }
+    out_plan.key = key;
+    out_plan.type = define->type;
+    out_plan.big_endian = big_endian;
+    out_plan.is_signed = signal["signed"] && signal["signed"].as<bool>();
+    out_plan.shift = static_cast<uint8_t>(shift);
+    out_plan.length = static_cast<uint8_t>(length);
+    out_plan.mask = (static_cast<uint64_t>(1) << length) - 1;
+    out_plan.factor = signal["factor"] ? signal["factor"].as<double>() : 1.0;
+    out_plan.offset = signal["offset"] ? signal["offset"].as<double>() : 0.0;
+    return true;
+}
+
+void CanIngest::socket_thread() {
+#ifdef __linux__
+    spdlog::info("初始化CAN接口[{}]采集线程", interface_);
+    int fd = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (fd < 0) {
+        spdlog::error("创建CAN套接字失败[{}]", std::strerror(errno));
+        return;
+    }
+    struct ifreq ifr{};
+    std::strncpy(ifr.ifr_name, interface_.c_str(), IFNAMSIZ - 1);
+    if (::ioctl(fd, SIOCGIFINDEX, &ifr) < 0) {
+        spdlog::error("CAN接口[{}]不存在[{}]", interface_, std::strerror(errno));
+        ::close(fd);
+        return;
+    }
+    // 只接收配置了解析计划的数据帧，其余由内核过滤，掩码包含扩展帧与远程帧标识，低位相同的扩展帧与远程帧不会匹配标准帧
+    std::vector<struct can_filter> filters;
+    for (const auto &frame_plan: frame_plans_) {
+        struct can_filter filter{};
+        filter.can_id = frame_plan.first;
+        filter.can_mask = CAN_EFF_FLAG | CAN_RTR_FLAG | (frame_plan.first & CAN_EFF_FLAG ? CAN_EFF_MASK : CAN_SFF_MASK);
+        filters.push_back(filter);
+    }
+    ::setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FILTER, filters.data(),
+                 static_cast<socklen_t>(filters.size() * sizeof(struct can_filter)));
+    // 设置读超时，保证停止时线程能够退出
+    struct timeval timeout{1, 0};
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    struct sockaddr_can addr{};
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (::bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
+        spdlog::error("绑定CAN接口[{}]失败[{}]", interface_, std::strerror(errno));
+        ::close(fd);
+        return;
+    }
+    struct can_frame frame{};
+    while (is_started_) {
+        ssize_t n = ::read(fd, &frame, sizeof(frame));
+        if (n != static_cast<ssize_t>(sizeof(frame))) {
+            continue;
+        }
+        if (frame.can_id & (CAN_RTR_FLAG | CAN_ERR_FLAG)) {
+            continue;
+        }
+        uint32_t can_id = frame.can_id & (frame.can_id & CAN_EFF_FLAG ? CAN_EFF_FLAG | CAN_EFF_MASK : CAN_SFF_MASK);
+        decode_frame(can_id, frame.data, frame.can_dlc);
+    }
+    ::close(fd);
+#else
+    spdlog::error("当前平台不支持SocketCAN");
+#endif
+}
+
+void CanIngest::replay_thread() {
+    spdlog::info("初始化candump日志[{}]回放线程", replay_file_);
+    std::ifstream file(replay_file_);
+    if (!file.is_open()) {
+        spdlog::error("candump日志[{}]不存在", replay_file_);
+        return;
+    }
+    std::string line;
+    double first_timestamp = -1;
+    auto replay_start = std::chrono::steady_clock::now();
+    uint8_t data[8];
+    while (is_started_ && std::getline(file, line)) {
+        double timestamp;
+        uint32_t can_id;
+        uint8_t length;
+        if (!parse_candump_line(line, timestamp, can_id, data, length)) {
+            continue;
+        }
+        if (replay_realtime_) {
+            if (first_timestamp < 0) {
+                first_timestamp = timestamp;
+            }
+            auto due = replay_start + std::chrono::microseconds(
+                    static_cast<long long>((timestamp - first_timestamp) * 1000000));
+            std::this_thread::sleep_until(due);
+        }
+        decode_frame(can_id, data, length);
+    }
+    spdlog::info("candump日志回放结束，共解析报文[{}]帧", frame_count_.load());
+}
+
+bool CanIngest::parse_candump_line(const std::string &line, double &out_timestamp, uint32_t &out_can_id,
+                                   uint8_t *out_data, uint8_t &out_length) {
+    std::istringstream stream(line);
+    std::string timestamp;
+    std::string interface;
+    std::string frame;
+    if (!(stream >> timestamp >> interface >> frame)) {
+        return false;
+    }
+    if (timestamp.size() < 3 || timestamp.front() != '(' || timestamp.back() != ')') {
+        return false;
+    }
+    size_t hash_pos = frame.find('#');
+    if (hash_pos == std::string::npos || hash_pos == 0) {
+        return false;
+    }
+    try {
+        out_timestamp = std::stod(timestamp.substr(1, timestamp.size() - 2));
+        out_can_id = static_cast<uint32_t>(std::stoul(frame.substr(0, hash_pos), nullptr, 16));
+    } catch (const std::exception &e) {
+        return false;
+    }
+    // candump以3位十六进制表示标准帧ID，8位表示扩展帧ID
+    if (hash_pos == 8 && out_can_id <= kCanExtendedMask) {
+        out_can_id |= kCanExtendedFlag;
+    } else if (hash_pos != 3 || out_can_id > kCanStandardMask) {
+        return false;
+    }
+    // 远程帧没有数据
+    if (hash_pos + 1 < frame.size() && frame[hash_pos + 1] == 'R') {
+        return false;
+    }
+    size_t hex_length = frame.size() - hash_pos - 1;
+    if (hex_length % 2 != 0 || hex_length > 16) {
+        return false;
+    }
+    out_length = static_cast<uint8_t>(hex_length / 2);
+    for (uint8_t i = 0; i < out_length; i++) {
+        char hex[3] = {frame[hash_pos + 1 + i * 2], frame[hash_pos + 2 + i * 2], 0};
+        char *end = nullptr;
+        out_data[i] = static_cast<uint8_t>(std::strtoul(hex, &end, 16));
+        if (end != hex + 2) {
+            return false;
+        }
+    }
+    return true;
+}
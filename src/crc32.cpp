@@ -0,0 +1,30 @@
+//
+// Created by hwyz_leo on 2025/8/29.
+//
+#include "crc32.h"
+
+namespace {
+struct crc32_table_t {
+    uint32_t values[256];
+
+    crc32_table_t() : values() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+            }
+            values[i] = value;
+        }
+    }
+};
+
+const crc32_table_t kCrc32Table;
+}
+
+uint32_t calculate_crc32(const uint8_t *data, size_t length, uint32_t crc) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc = kCrc32Table.values[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
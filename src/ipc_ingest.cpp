@@ -0,0 +1,169 @@
+//
+// Created by hwyz_leo on 2025/8/28.
+//
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "spdlog/spdlog.h"
+
+#include "ipc_ingest.h"
+#include "mqtt_mcu_handler.h"
+
+IpcIngest &IpcIngest::get_instance() {
+    static IpcIngest instance;
+    return instance;
+}
+
+bool IpcIngest::load_config(const YAML::Node &config) {
+    spdlog::info("加载本地IPC数据接入配置信息");
+    if (config["ingest"]) {
+        if (config["ingest"]["transport"]) {
+            std::string transport = config["ingest"]["transport"].as<std::string>();
+            if (transport == "ipc") {
+                transport_ = INGEST_TRANSPORT_IPC;
+            } else if (transport == "mqtt") {
+                transport_ = INGEST_TRANSPORT_MQTT;
+            } else {
+                spdlog::error("不支持的MCU数据接入方式[{}]", transport);
+                return false;
+            }
+        }
+        if (config["ingest"]["ipc-path"]) {
+            socket_path_ = config["ingest"]["ipc-path"].as<std::string>();
+        }
+    }
+    return true;
+}
+
+bool IpcIngest::start() {
+    if (transport_ != INGEST_TRANSPORT_IPC || is_started_) {
+        return is_started_;
+    }
+    spdlog::info("启动本地IPC数据接入[{}]", socket_path_);
+    struct sockaddr_un addr{};
+    if (socket_path_.size() >= sizeof(addr.sun_path)) {
+        spdlog::error("套接字路径[{}]过长", socket_path_);
+        return false;
+    }
+    int listen_fd = ::socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (listen_fd < 0) {
+        spdlog::error("创建IPC套接字失败[{}]", std::strerror(errno));
+        return false;
+    }
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
+    ::unlink(socket_path_.c_str());
+    if (::bind(listen_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0 ||
+        ::listen(listen_fd, 4) < 0) {
+        spdlog::error("监听IPC套接字[{}]失败[{}]", socket_path_, std::strerror(errno));
+        ::close(listen_fd);
+        return false;
+    }
+    MqttMcuHandler &mcu_handler = MqttMcuHandler::get_instance();
+    topic_router_.add(topic_prefix_ + "MCU_DATA", mcu_handler);
+    topic_router_.add(topic_prefix_ + "MCU_DATA/V2/DELTA", mcu_handler.format_handler(MCU_FORMAT_V2_DELTA));
+    topic_router_.add(topic_prefix_ + "MCU_DATA/V2/FAST", mcu_handler.format_handler(MCU_FORMAT_V2_FAST));
+    topic_router_.add(topic_prefix_ + "MCU_DATA/V2/POSITION", mcu_handler.format_handler(MCU_FORMAT_V2_POSITION));
+    topic_router_.add(topic_prefix_ + "MCU_DATA/V2/CELL", mcu_handler.format_handler(MCU_FORMAT_V2_CELL));
+    topic_router_.add(topic_prefix_ + "MCU_DATA/V2/SLOW", mcu_handler.format_handler(MCU_FORMAT_V2_SLOW));
+    is_started_ = true;
+    receive_thread_ = std::thread(&IpcIngest::receive_thread, this, listen_fd);
+    return true;
+}
+
+void IpcIngest::stop() {
+    if (!is_started_) {
+        return;
+    }
+    spdlog::info("停止本地IPC数据接入，共接收数据包[{}]个", packet_count_.load());
+    is_started_ = false;
+    if (receive_thread_.joinable()) {
+        receive_thread_.join();
+    }
+    ::unlink(socket_path_.c_str());
+}
+
+ingest_transport_t IpcIngest::get_transport() const {
+    return transport_;
+}
+
+void IpcIngest::receive_thread(int listen_fd) {
+    spdlog::info("初始化IPC接收线程");
+    // 第一个为监听套接字，其余为已连接的MCU桥接进程
+    std::vector<struct pollfd> fds;
+    fds.push_back({listen_fd, POLLIN, 0});
+    std::vector<char> buffer(64 * 1024);
+    while (is_started_) {
+        int rc = ::poll(fds.data(), fds.size(), 1000);
+        if (rc <= 0) {
+            continue;
+        }
+        if (fds[0].revents & POLLIN) {
+            int client_fd = ::accept(listen_fd, nullptr, nullptr);
+            if (client_fd >= 0) {
+                spdlog::info("MCU桥接进程已连接IPC[{}]", client_fd);
+                fds.push_back({client_fd, POLLIN, 0});
+            }
+        }
+        for (size_t i = 1; i < fds.size();) {
+            if (fds[i].revents == 0) {
+                i++;
+                continue;
+            }
+            // 一次唤醒尽量读完所有已到达的数据包，对端关闭时先读完剩余数据包
+            bool is_closed = false;
+            while (!is_closed) {
+                ssize_t n = ::recv(fds[i].fd, buffer.data(), buffer.size(), MSG_DONTWAIT | MSG_TRUNC);
+                if (n > 0) {
+                    if (static_cast<size_t>(n) > buffer.size()) {
+                        spdlog::warn("IPC数据包过大[{}]，已丢弃", n);
+                        continue;
+                    }
+                    dispatch(buffer.data(), static_cast<size_t>(n));
+                } else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                    is_closed = true;
+                } else {
+                    break;
+                }
+            }
+            if (is_closed) {
+                spdlog::info("MCU桥接进程断开IPC[{}]", fds[i].fd);
+                ::close(fds[i].fd);
+                fds.erase(fds.begin() + static_cast<long>(i));
+            } else {
+                i++;
+            }
+        }
+    }
+    for (const auto &fd: fds) {
+        ::close(fd.fd);
+    }
+}
+
+void IpcIngest::dispatch(const char *packet, size_t length) {
+    if (length < 1) {
+        return;
+    }
+    size_t topic_length = static_cast<uint8_t>(packet[0]);
+    if (topic_length == 0 || 1 + topic_length > length) {
+        spdlog::warn("IPC数据包主题长度[{}]无效", topic_length);
+        return;
+    }
+    // 主题最长255字节，复制到栈上补结束符后路由
+    char topic[256];
+    std::memcpy(topic, packet + 1, topic_length);
+    topic[topic_length] = '\0';
+    MqttMessageHandler *handler = topic_router_.route(topic);
+    if (handler == nullptr) {
+        spdlog::debug("收到未知主题[{}]IPC数据包", topic);
+        return;
+    }
+    packet_count_++;
+    handler->handle(std::string(packet + 1 + topic_length, length - 1 - topic_length));
+}
@@ -0,0 +1,149 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+#include <cstring>
+
+#include "lz4_block.h"
+
+namespace {
+// 最短匹配长度
+const size_t kMinMatch = 4;
+// 最后一个匹配必须在数据结束前12字节之前开始
+const size_t kMatchStartLimit = 12;
+// 最后5字节必须为字面量
+const size_t kLastLiterals = 5;
+// 最大匹配距离
+const size_t kMaxOffset = 65535;
+// 哈希表位数
+const int kHashBits = 12;
+
+uint32_t read32(const uint8_t *data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+uint32_t hash32(uint32_t value) {
+    return (value * 2654435761u) >> (32 - kHashBits);
+}
+
+/**
+ * 写入超过15的长度的剩余部分
+ */
+void write_length(size_t length, std::vector<uint8_t> &out) {
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+/**
+ * 写入一个序列：字面量，及可选的匹配（match_length为0时为最后的字面量）
+ */
+void write_sequence(const uint8_t *literals, size_t literal_length, size_t offset, size_t match_length,
+                    std::vector<uint8_t> &out) {
+    size_t match_code = match_length > 0 ? match_length - kMinMatch : 0;
+    uint8_t token = static_cast<uint8_t>((literal_length < 15 ? literal_length : 15) << 4 |
+                                         (match_code < 15 ? match_code : 15));
+    out.push_back(token);
+    if (literal_length >= 15) {
+        write_length(literal_length - 15, out);
+    }
+    out.insert(out.end(), literals, literals + literal_length);
+    if (match_length == 0) {
+        return;
+    }
+    out.push_back(static_cast<uint8_t>(offset & 0xFF));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (match_code >= 15) {
+        write_length(match_code - 15, out);
+    }
+}
+
+/**
+ * 读取超过15的长度的剩余部分
+ */
+bool read_length(const uint8_t *data, size_t length, size_t &position, size_t &value) {
+    uint8_t byte;
+    do {
+        if (position >= length) {
+            return false;
+        }
+        byte = data[position++];
+        value += byte;
+    } while (byte == 255);
+    return true;
+}
+}
+
+void lz4_compress_block(const uint8_t *data, size_t length, std::vector<uint8_t> &out) {
+    size_t anchor = 0;
+    if (length > kMatchStartLimit) {
+        std::vector<int64_t> table(static_cast<size_t>(1) << kHashBits, -1);
+        size_t match_end_limit = length - kLastLiterals;
+        size_t position = 0;
+        while (position + kMatchStartLimit < length) {
+            uint32_t sequence = read32(data + position);
+            uint32_t hash = hash32(sequence);
+            int64_t reference = table[hash];
+            table[hash] = static_cast<int64_t>(position);
+            if (reference < 0 || position - static_cast<size_t>(reference) > kMaxOffset ||
+                read32(data + reference) != sequence) {
+                position++;
+                continue;
+            }
+            size_t match_length = kMinMatch;
+            while (position + match_length < match_end_limit &&
+                   data[reference + match_length] == data[position + match_length]) {
+                match_length++;
+            }
+            write_sequence(data + anchor, position - anchor, position - static_cast<size_t>(reference), match_length,
+                           out);
+            position += match_length;
+            anchor = position;
+        }
+    }
+    write_sequence(data + anchor, length - anchor, 0, 0, out);
+}
+
+bool lz4_decompress_block(const uint8_t *data, size_t length, size_t raw_length, std::vector<uint8_t> &out) {
+    size_t base = out.size();
+    size_t position = 0;
+    while (position < length) {
+        uint8_t token = data[position++];
+        size_t literal_length = token >> 4;
+        if (literal_length == 15 && !read_length(data, length, position, literal_length)) {
+            return false;
+        }
+        if (literal_length > length - position || out.size() - base + literal_length > raw_length) {
+            return false;
+        }
+        out.insert(out.end(), data + position, data + position + literal_length);
+        position += literal_length;
+        // 最后一个序列只有字面量
+        if (position == length) {
+            break;
+        }
+        if (length - position < 2) {
+            return false;
+        }
+        size_t offset = data[position] | static_cast<size_t>(data[position + 1]) << 8;
+        position += 2;
+        size_t match_length = token & 0x0F;
+        if (match_length == 15 && !read_length(data, length, position, match_length)) {
+            return false;
+        }
+        match_length += kMinMatch;
+        if (offset == 0 || offset > out.size() - base || out.size() - base + match_length > raw_length) {
+            return false;
+        }
+        // 匹配可以与正在写入的数据重叠，逐字节复制
+        size_t source = out.size() - offset;
+        for (size_t i = 0; i < match_length; i++) {
+            uint8_t byte = out[source + i];
+            out.push_back(byte);
+        }
+    }
+    return out.size() - base == raw_length;
+}
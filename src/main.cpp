@@ -5,13 +5,40 @@
 #include "spdlog/spdlog.h"
 
 #include "mqtt_client.h"
+#include "mqtt_trace.h"
+#include "mqtt_mcu_handler.h"
+#include "mqtt_tsp_connect_handler.h"
+#include "mqtt_tsp_reissue_handler.h"
+#include "mqtt_network_up_handler.h"
+#include "can_ingest.h"
+#include "ipc_ingest.h"
 #include "rsms_signal_cache.h"
 #include "rsms_client.h"
+#include "rsms_uplink_scheduler.h"
 
 class MainApplication : public hwyz::Application {
 protected:
     bool initialize() override {
-        if (!MqttClient::get_instance().load_config(getConfig())) {
+        if (!MqttTrace::get_instance().load_config(getConfig())) {
+            return false;
+        }
+        if (!MqttClient::get_local().load_config(getConfig())) {
+            return false;
+        }
+        if (!MqttClient::get_uplink().load_config(getConfig())) {
+            return false;
+        }
+        if (!CanIngest::get_instance().load_config(getConfig())) {
+            return false;
+        }
+        if (!IpcIngest::get_instance().load_config(getConfig())) {
+            return false;
+        }
+        add_subscriptions();
+        if (!RsmsClient::get_instance().load_config(getConfig())) {
+            return false;
+        }
+        if (!RsmsUplinkScheduler::get_instance().load_config(getConfig())) {
             return false;
         }
         return true;
@@ -19,17 +46,54 @@ protected:
 
     void cleanup() override {
         RsmsClient::get_instance().stop();
-        MqttClient::get_instance().stop();
+        RsmsUplinkScheduler::get_instance().stop();
+        CanIngest::get_instance().stop();
+        IpcIngest::get_instance().stop();
+        MqttClient::get_uplink().stop();
+        MqttClient::get_local().stop();
+        MqttTrace::get_instance().stop();
         RsmsSignalCache::get_instance().stop();
     }
 
     int execute() override {
-        MqttClient::get_instance().start();
+        MqttTrace::get_instance().start();
+        MqttClient::get_local().start();
+        MqttClient::get_uplink().start();
         RsmsSignalCache::get_instance().start();
+        CanIngest::get_instance().start();
+        IpcIngest::get_instance().start();
+        RsmsUplinkScheduler::get_instance().start();
         RsmsClient::get_instance().start();
         spdlog::info("主函数运行");
         return 0;
     }
+
+private:
+    /**
+     * 添加MQTT订阅：TSP连接状态与按时间范围补发经上行连接订阅，MCU数据与网络恢复通知经本地连接订阅
+     */
+    static void add_subscriptions() {
+        MqttClient &uplink = MqttClient::get_uplink();
+        uplink.add_subscription("GLOBAL/TSP_CONNECT", MqttTspConnectHandler::get_instance(), 1);
+        uplink.add_subscription("GLOBAL/TSP_REISSUE", MqttTspReissueHandler::get_instance(), 1);
+        // 上行断开期间仍能经本地连接收到网络恢复通知
+        if (!uplink.get_network_up_topic().empty()) {
+            MqttClient::get_local().add_subscription(uplink.get_network_up_topic(),
+                                                     MqttNetworkUpHandler::get_instance(), 1);
+        }
+        // MCU数据改由本地IPC接入时不再订阅
+        if (IpcIngest::get_instance().get_transport() != INGEST_TRANSPORT_MQTT) {
+            return;
+        }
+        MqttClient &local = MqttClient::get_local();
+        MqttMcuHandler &mcu_handler = MqttMcuHandler::get_instance();
+        local.add_subscription("RSMS/MCU_DATA", mcu_handler, 1);
+        local.add_subscription("RSMS/MCU_DATA/V2/DELTA", mcu_handler.format_handler(MCU_FORMAT_V2_DELTA), 1);
+        local.add_subscription("RSMS/MCU_DATA/V2/FAST", mcu_handler.format_handler(MCU_FORMAT_V2_FAST), 0);
+        local.add_subscription("RSMS/MCU_DATA/V2/POSITION", mcu_handler.format_handler(MCU_FORMAT_V2_POSITION), 0);
+        local.add_subscription("RSMS/MCU_DATA/V2/CELL", mcu_handler.format_handler(MCU_FORMAT_V2_CELL), 1);
+        local.add_subscription("RSMS/MCU_DATA/V2/SLOW", mcu_handler.format_handler(MCU_FORMAT_V2_SLOW), 1);
+    }
 };
 
 APPLICATION_ENTRY(MainApplication)
\ No newline at end of file
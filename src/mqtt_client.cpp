@@ -1,67 +1,175 @@
 //
 // Created by hwyz_leo on 2025/8/4.
 //
-#include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <regex>
 
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <openssl/ssl.h>
+
 #include "spdlog/spdlog.h"
 #include "nlohmann/json.hpp"
 #include "utils.h"
 
 #include "mqtt_client.h"
-#include "mqtt_mcu_handler.h"
-#include "mqtt_tsp_connect_handler.h"
+#include "mqtt_trace.h"
 
 using json = nlohmann::json;
 
-MqttClient::MqttClient() : mosqpp::mosquittopp() {}
+namespace {
+    /**
+     * 获取文件修改时间
+     * @param path 文件路径
+     * @return 修改时间（纳秒），文件不存在时为0
+     */
+    long long file_mtime(const std::string &path) {
+        struct stat file_stat{};
+        if (path.empty() || ::stat(path.c_str(), &file_stat) != 0) {
+            return 0;
+        }
+        return static_cast<long long>(file_stat.st_mtim.tv_sec) * 1000000000LL + file_stat.st_mtim.tv_nsec;
+    }
+}
+
+MqttClient::MqttClient(std::string name, std::string client_id_suffix)
+        : name_(std::move(name)), client_id_suffix_(std::move(client_id_suffix)) {}
 
 MqttClient::~MqttClient() {
-    mosqpp::lib_cleanup();
+    if (mosq_ != nullptr) {
+        mosquitto_destroy(mosq_);
+    }
+    if (tls_session_ != nullptr) {
+        SSL_SESSION_free(tls_session_);
+    }
+    if (ssl_ctx_ != nullptr) {
+        SSL_CTX_free(ssl_ctx_);
+    }
+    if (is_inited_) {
+        mosquitto_lib_cleanup();
+    }
+}
+
+MqttClient &MqttClient::get_local() {
+    static MqttClient instance("local", "-local");
+    return instance;
 }
 
-MqttClient &MqttClient::get_instance() {
-    static MqttClient instance;
+MqttClient &MqttClient::get_uplink() {
+    static MqttClient instance("uplink", "");
     return instance;
 }
 
 bool MqttClient::load_config(const YAML::Node &config) {
-    spdlog::info("加载MQTT客户端配置信息");
+    spdlog::info("加载MQTT客户端[{}]配置信息", name_);
     if (config["mqtt"]) {
-        if (config["mqtt"]["host"]) {
-            server_host_ = config["mqtt"]["host"].as<std::string>();
-        }
-        if (config["mqtt"]["port"]) {
-            server_port_ = config["mqtt"]["port"].as<std::uint16_t>();
-        }
-        if (config["mqtt"]["keepalive"]) {
-            keepalive_ = config["mqtt"]["keepalive"].as<std::uint16_t>();
-        }
-        if (config["mqtt"]["use-ssl"]) {
-            use_ssl_ = config["mqtt"]["use-ssl"].as<bool>();
-        }
-        if (config["mqtt"]["reconnect-interval-second"]) {
-            reconnect_interval_second_ = config["mqtt"]["reconnect-interval-second"].as<int>();
-        }
-        if (config["mqtt"]["username"]) {
-            username_ = config["mqtt"]["username"].as<std::string>();
-        }
-        if (config["mqtt"]["password"]) {
-            password_ = config["mqtt"]["password"].as<std::string>();
-        }
-        if (config["mqtt"]["client-id"]) {
-            client_id_ = config["mqtt"]["client-id"].as<std::string>();
+        load_connection_config(config["mqtt"]);
+        client_id_ += client_id_suffix_;
+        if (config["mqtt"][name_]) {
+            load_connection_config(config["mqtt"][name_]);
         }
+    } else {
+        client_id_ += client_id_suffix_;
     }
-
     return true;
 }
 
+void MqttClient::load_connection_config(const YAML::Node &node) {
+    if (node["host"]) {
+        server_host_ = node["host"].as<std::string>();
+    }
+    if (node["port"]) {
+        server_port_ = node["port"].as<std::uint16_t>();
+    }
+    if (node["keepalive"]) {
+        keepalive_ = node["keepalive"].as<std::uint16_t>();
+    }
+    if (node["use-ssl"]) {
+        use_ssl_ = node["use-ssl"].as<bool>();
+    }
+    if (node["ca-file"]) {
+        ca_file_ = node["ca-file"].as<std::string>();
+    }
+    if (node["cert-file"]) {
+        cert_file_ = node["cert-file"].as<std::string>();
+    }
+    if (node["key-file"]) {
+        key_file_ = node["key-file"].as<std::string>();
+    }
+    if (node["tls-session-file"]) {
+        tls_session_file_ = node["tls-session-file"].as<std::string>();
+    }
+    if (node["reconnect-interval-second"]) {
+        reconnect_interval_second_ = node["reconnect-interval-second"].as<int>();
+    }
+    if (node["reconnect-base-milli-second"]) {
+        reconnect_base_milli_second_ = node["reconnect-base-milli-second"].as<int>();
+    }
+    if (node["connect-timeout-second"]) {
+        connect_timeout_second_ = node["connect-timeout-second"].as<int>();
+    }
+    if (node["stop-drain-milli-second"]) {
+        stop_drain_milli_second_ = node["stop-drain-milli-second"].as<int>();
+    }
+    if (node["network-up-topic"]) {
+        network_up_topic_ = node["network-up-topic"].as<std::string>();
+    }
+    if (node["network-up-file"]) {
+        network_up_file_ = node["network-up-file"].as<std::string>();
+    }
+    if (node["username"]) {
+        username_ = node["username"].as<std::string>();
+    }
+    if (node["password"]) {
+        password_ = node["password"].as<std::string>();
+    }
+    if (node["client-id"]) {
+        client_id_ = node["client-id"].as<std::string>();
+    }
+    if (node["publish-queue-depth"]) {
+        max_publish_queue_depth_ = node["publish-queue-depth"].as<size_t>();
+    }
+    if (node["max-inflight-messages"]) {
+        max_inflight_messages_ = node["max-inflight-messages"].as<size_t>();
+    }
+    if (node["use-mqtt5"]) {
+        use_mqtt5_ = node["use-mqtt5"].as<bool>();
+    }
+    if (node["metrics-interval-second"]) {
+        metrics_interval_second_ = node["metrics-interval-second"].as<int>();
+    }
+    if (node["metrics-topic"]) {
+        metrics_topic_ = node["metrics-topic"].as<std::string>();
+    }
+}
+
+void MqttClient::add_subscription(const std::string &topic, MqttMessageHandler &handler, int qos) {
+    subscriptions_.push_back({topic, &handler, qos});
+}
+
 bool MqttClient::start() {
     if (!is_started_) {
-        spdlog::info("启动MQTT客户端");
-        this->connect_manage();
+        spdlog::info("启动MQTT客户端[{}]", name_);
+        // 事件循环描述符在连接线程启动前创建，其他线程唤醒时无需同步
+        if (!init_event_loop()) {
+            return false;
+        }
         is_started_ = true;
+        this->connect_manage();
     }
     return is_started_;
 }
@@ -70,108 +178,214 @@ void MqttClient::stop() {
     if (!is_started_) {
         return;
     }
-    spdlog::info("停止MQTT客户端");
-    this->disconnect();
-    mosqpp::lib_cleanup();
+    spdlog::info("停止MQTT客户端[{}]", name_);
     is_started_ = false;
+    wake();
+    if (connector.joinable()) {
+        connector.join();
+    }
+    close_event_loop();
+    if (mosq_ != nullptr) {
+        mosquitto_destroy(mosq_);
+        mosq_ = nullptr;
+    }
+    if (is_inited_) {
+        mosquitto_lib_cleanup();
+        is_inited_ = false;
+    }
 }
 
 bool MqttClient::is_connected() const {
     return is_connected_;
 }
 
-bool MqttClient::publish(int &mid, const std::string &topic, const void *payload, int payload_len, int qos) {
-    if (nullptr == payload) {
-        return false;
+publish_status_t MqttClient::publish(const std::string &topic, std::vector<uint8_t> &&payload, int qos,
+                                     uint64_t token, uint32_t expiry_second) {
+    if (topic.empty() || payload.empty()) {
+        return PUBLISH_INVALID;
     }
     if (!is_connected_) {
-        return false;
+        std::lock_guard<std::mutex> lock(metrics_mutex_);
+        topic_metrics(topic).failed++;
+        return PUBLISH_DISCONNECTED;
     }
-    int rc = mosquittopp::publish(&mid, topic.c_str(), payload_len, payload, qos, false);
-    std::vector<uint8_t> payload_vector(
-            static_cast<const uint8_t *>(payload),
-            static_cast<const uint8_t *>(payload) + payload_len
-    );
-    std::string hex_payload = hwyz::Utils::bytes_to_hex(payload_vector, true);
-    spdlog::info("发送[{}]消息至主题[{}]QOS[{}]", mid, topic, qos);
-    std::cout << hex_payload << std::endl;
-    if (rc == MOSQ_ERR_SUCCESS) {
-        cv_loop_.notify_all();
-        return true;
+    if (publish_depth_.fetch_add(1) >= max_publish_queue_depth_) {
+        publish_depth_.fetch_sub(1);
+        std::lock_guard<std::mutex> lock(metrics_mutex_);
+        topic_metrics(topic).rejected++;
+        return PUBLISH_QUEUE_FULL;
     }
-    return false;
+    publish_queue_.push({topic, std::move(payload), qos, token, expiry_second, std::chrono::steady_clock::now()});
+    wake();
+    return PUBLISH_QUEUED;
 }
 
-bool MqttClient::publish(int &mid, const std::string &topic, std::vector<uint8_t> *payload, int qos) {
-    if (nullptr == payload) {
-        return false;
-    }
-    if (!is_connected_) {
-        return false;
-    }
-    int rc = mosquittopp::publish(&mid, topic.c_str(), static_cast<int>(payload->size()), payload->data(), qos, false);
-    std::string hex_payload = hwyz::Utils::bytes_to_hex(*payload, true);
-    spdlog::info("发送[{}]消息至主题[{}]QOS[{}]", mid, topic, qos);
-    std::cout << hex_payload << std::endl;
-    if (rc == MOSQ_ERR_SUCCESS) {
-        cv_loop_.notify_all();
-        return true;
-    }
-    return false;
+void MqttClient::set_publish_listener(MqttPublishListener *listener) {
+    publish_listener_ = listener;
 }
 
-void MqttClient::on_connect(int rc) {
-    is_connecting_ = false;
-    is_connected_ = (rc == MOSQ_ERR_SUCCESS);
-    if (is_connected_) {
-        spdlog::info("MQTT客户端连接成功");
-        int mid = 0;
-        subscribe_topic(mid, "GLOBAL/TSP_CONNECT", MqttTspConnectHandler::get_instance(), 1);
-        subscribe_topic(mid, topic_prefix_ + "MCU_DATA", MqttMcuHandler::get_instance(), 1);
-        is_subscribed_ = true;
-    }
+std::map<std::string, mqtt_topic_metrics_t> MqttClient::get_topic_metrics() {
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+    return topic_metrics_;
 }
 
-void MqttClient::on_disconnect(int rc) {
-    spdlog::info("MQTT客户端断开[{}]", rc);
-    is_connecting_ = false;
-    is_connected_ = false;
+void MqttClient::notify_network_up() {
+    is_network_up_ = true;
+    wake();
 }
 
-void MqttClient::on_publish(int rc) {
-    spdlog::info("发送[{}]消息成功", rc);
+const std::string &MqttClient::get_network_up_topic() const {
+    return network_up_topic_;
 }
 
-void MqttClient::on_message(const struct mosquitto_message *message) {
-    std::string topic = message->topic;
-    spdlog::debug("收到消息主题[{}]内容[{}]", topic, static_cast<char *>(message->payload));
-    std::string payload = hwyz::Utils::base64_decode(
-            std::string(static_cast<char *>(message->payload), message->payloadlen));
-    if (message_handler_[topic]) {
-        message_handler_[topic]->handle(payload);
+void MqttClient::on_connect(int rc, const mosquitto_property *properties) {
+    // 主题别名只在本次连接内有效
+    send_maximum_ = max_inflight_messages_;
+    topic_alias_maximum_ = 0;
+    topic_aliases_.clear();
+    if (use_mqtt5_ && properties != nullptr) {
+        uint16_t value = 0;
+        if (mosquitto_property_read_int16(properties, MQTT_PROP_RECEIVE_MAXIMUM, &value, false) != nullptr &&
+            value > 0) {
+            send_maximum_ = std::min<size_t>(send_maximum_, value);
+        }
+        if (mosquitto_property_read_int16(properties, MQTT_PROP_TOPIC_ALIAS_MAXIMUM, &value, false) != nullptr) {
+            topic_alias_maximum_ = value;
+        }
+    }
+    if (rc != MOSQ_ERR_SUCCESS) {
+        spdlog::warn("MQTT客户端[{}]连接被拒绝[{}]", name_, rc);
+        schedule_reconnect();
+        return;
+    }
+    connect_state_ = CONNECT_STATE_CONNECTED;
+    is_connected_ = true;
+    long long elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - disconnected_time_).count();
+    if (has_connected_) {
+        reconnect_count_++;
+        reconnect_total_milli_second_ += elapsed_ms;
+        reconnect_max_milli_second_ = std::max(reconnect_max_milli_second_, elapsed_ms);
+        spdlog::info("MQTT客户端[{}]断开[{}]毫秒后重连成功，尝试[{}]次，累计重连[{}]次平均耗时[{}]毫秒最大耗时[{}]毫秒",
+                     name_, elapsed_ms, connect_attempts_, reconnect_count_,
+                     reconnect_total_milli_second_ / static_cast<long long>(reconnect_count_),
+                     reconnect_max_milli_second_);
+    } else {
+        spdlog::info("MQTT客户端[{}]启动[{}]毫秒后首次连接成功，尝试[{}]次", name_, elapsed_ms, connect_attempts_);
+    }
+    has_connected_ = true;
+    connect_attempts_ = 0;
+    backoff_ = std::chrono::milliseconds(0);
+    // 连接期间的网络恢复通知已无意义
+    is_network_up_ = false;
+    network_up_file_mtime_ = file_mtime(network_up_file_);
+    SSL *ssl = use_ssl_ ? static_cast<SSL *>(mosquitto_ssl_get(mosq_)) : nullptr;
+    if (ssl != nullptr) {
+        bool is_resumed = SSL_session_reused(ssl) == 1;
+        (is_resumed ? tls_resumed_count_ : tls_full_count_)++;
+        spdlog::info("MQTT客户端[{}]TLS[{}]{}，累计完整握手[{}]次会话恢复[{}]次", name_, SSL_get_version(ssl),
+                     is_resumed ? "会话恢复" : "完整握手", tls_full_count_, tls_resumed_count_);
     }
+    spdlog::info("MQTT客户端[{}]连接成功，在途上限[{}]主题别名上限[{}]", name_, send_maximum_, topic_alias_maximum_);
+    int mid = 0;
+    for (const auto &subscription: subscriptions_) {
+        subscribe_topic(mid, subscription.topic, *subscription.handler, subscription.qos);
+    }
+    is_subscribed_ = true;
 }
 
-void MqttClient::on_subscribe(int mid, int qos_count, const int *granted_qos) {
-
+void MqttClient::on_disconnect(int rc) {
+    spdlog::info("MQTT客户端[{}]断开[{}]", name_, rc);
+    if (connect_state_ == CONNECT_STATE_CONNECTED) {
+        // 连接断开后首次重连立即进行
+        disconnected_time_ = std::chrono::steady_clock::now();
+        connect_attempts_ = 0;
+        schedule_reconnect();
+    } else if (connect_state_ == CONNECT_STATE_CONNECTING) {
+        schedule_reconnect();
+    }
+    is_connected_ = false;
+    if (!publish_inflight_.empty()) {
+        // 未确认的消息随连接丢失
+        std::lock_guard<std::mutex> lock(metrics_mutex_);
+        for (const auto &inflight: publish_inflight_) {
+            inflight.second.metrics->dropped++;
+        }
+    }
+    publish_inflight_.clear();
+    MqttPublishListener *listener = publish_listener_;
+    if (listener != nullptr) {
+        listener->on_connection_lost();
+    }
+    // 尚未发布的消息回调失败
+    flush_publishes();
 }
 
-void MqttClient::on_unsubscribe(int mid) {
-
+void MqttClient::on_publish(int mid, int reason_code) {
+    if (reason_code >= 0x80) {
+        // 服务端已收到但拒绝处理，重发也不会成功，按已确认处理
+        spdlog::warn("发送[{}]消息被服务端拒绝[{}]", mid, reason_code);
+    } else {
+        MqttTrace::get_instance().trace_ack(name_, mid);
+    }
+    auto it = publish_inflight_.find(mid);
+    if (it != publish_inflight_.end()) {
+        auto latency = std::chrono::steady_clock::now() - it->second.submit_time;
+        std::lock_guard<std::mutex> lock(metrics_mutex_);
+        it->second.metrics->acked++;
+        it->second.metrics->latency.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(latency).count()));
+        publish_inflight_.erase(it);
+    }
+    MqttPublishListener *listener = publish_listener_;
+    if (listener != nullptr) {
+        listener->on_publish_ack(mid);
+    }
 }
 
-void MqttClient::on_log(int level, const char *str) {
-
+void MqttClient::on_message(const struct mosquitto_message *message) {
+    MqttMessageHandler *handler = topic_router_.route(message->topic);
+    if (handler == nullptr) {
+        spdlog::debug("收到未订阅主题[{}]消息", message->topic);
+        return;
+    }
+    MqttTrace::get_instance().trace_receive(name_, message->topic, message->payload,
+                                            static_cast<size_t>(message->payloadlen));
+    {
+        std::lock_guard<std::mutex> lock(metrics_mutex_);
+        mqtt_topic_metrics_t &metrics = topic_metrics(message->topic);
+        metrics.received++;
+        metrics.bytes_in += static_cast<uint64_t>(message->payloadlen);
+    }
+    std::string payload = hwyz::Utils::base64_decode(
+            std::string(static_cast<char *>(message->payload), message->payloadlen));
+    handler->handle(payload);
 }
 
-void MqttClient::on_error() {
-    spdlog::info("MQTT客户端报错");
+void MqttClient::set_callbacks() {
+    // 回调均在网络线程中执行
+    mosquitto_connect_v5_callback_set(mosq_, [](struct mosquitto *, void *obj, int rc, int,
+                                                const mosquitto_property *properties) {
+        static_cast<MqttClient *>(obj)->on_connect(rc, properties);
+    });
+    mosquitto_disconnect_v5_callback_set(mosq_, [](struct mosquitto *, void *obj, int rc,
+                                                   const mosquitto_property *) {
+        static_cast<MqttClient *>(obj)->on_disconnect(rc);
+    });
+    mosquitto_publish_v5_callback_set(mosq_, [](struct mosquitto *, void *obj, int mid, int reason_code,
+                                                const mosquitto_property *) {
+        static_cast<MqttClient *>(obj)->on_publish(mid, reason_code);
+    });
+    mosquitto_message_v5_callback_set(mosq_, [](struct mosquitto *, void *obj, const struct mosquitto_message *message,
+                                                const mosquitto_property *) {
+        static_cast<MqttClient *>(obj)->on_message(message);
+    });
 }
 
 bool MqttClient::init() {
     if (!is_inited_) {
         spdlog::info("初始化MQTT客户端");
-        int rc = mosqpp::lib_init();
+        int rc = mosquitto_lib_init();
         if (rc == MOSQ_ERR_SUCCESS) {
             spdlog::info("MQTT客户端初始化成功");
             is_inited_ = true;
@@ -182,48 +396,501 @@ bool MqttClient::init() {
 
 void MqttClient::connect_manage() {
     std::thread th([&]() {
-        bool is_first_connect = true;
+        backoff_random_.seed(static_cast<std::minstd_rand::result_type>(std::random_device{}()));
+        connect_state_ = CONNECT_STATE_DISCONNECTED;
+        connect_attempts_ = 0;
+        disconnected_time_ = std::chrono::steady_clock::now();
+        next_connect_time_ = disconnected_time_;
+        network_up_file_mtime_ = file_mtime(network_up_file_);
+        last_metrics_time_ = std::chrono::steady_clock::now();
         while (is_started_) {
+            export_metrics();
             if (!init()) {
                 spdlog::info("MQTT客户端初始化失败");
-                std::this_thread::sleep_for(std::chrono::seconds(reconnect_interval_second_));
+                wait_wake(reconnect_interval_second_ * 1000);
                 continue;
             }
-            if (!is_connected_ && !is_connecting_) {
-                if (is_first_connect) {
-                    is_first_connect = false;
-                } else {
-                    std::this_thread::sleep_for(std::chrono::seconds(reconnect_interval_second_));
+            if (connect_state_ == CONNECT_STATE_DISCONNECTED) {
+                // 断开期间提交的消息回调失败
+                flush_publishes();
+                wait_reconnect();
+                if (!is_started_) {
+                    break;
                 }
+                // 断开时套接字已关闭并自动移出epoll，重连后重新注册
+                registered_socket_ = -1;
+                connect_attempts_++;
                 if (connect()) {
-                    is_connecting_ = true;
+                    connect_state_ = CONNECT_STATE_CONNECTING;
+                    auto now = std::chrono::steady_clock::now();
+                    connect_deadline_ = now + std::chrono::seconds(connect_timeout_second_);
+                    next_keepalive_time_ = now + std::chrono::milliseconds(keepalive_ * 500);
+                } else {
+                    schedule_reconnect();
                 }
             } else {
-                this->loop();
+                poll_events();
+                flush_publishes();
+                if (connect_state_ == CONNECT_STATE_CONNECTING &&
+                    std::chrono::steady_clock::now() >= connect_deadline_) {
+                    // 旧连接在下次连接重置客户端时关闭
+                    spdlog::warn("MQTT客户端[{}]等待连接确认超时", name_);
+                    schedule_reconnect();
+                }
             }
-            std::unique_lock<std::mutex> lock(mtx_loop_);
-            cv_loop_.wait_for(lock, std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::milliseconds(loop_interval_milli_second_)));
+        }
+        // 停止前发布已提交的消息（如登出）并等待确认后再断开
+        if (connect_state_ == CONNECT_STATE_CONNECTED) {
+            drain_publishes();
+            mosquitto_disconnect(mosq_);
         }
     });
     connector.swap(th);
 }
 
+void MqttClient::schedule_reconnect() {
+    connect_state_ = CONNECT_STATE_DISCONNECTED;
+    is_connected_ = false;
+    if (connect_attempts_ == 0) {
+        backoff_ = std::chrono::milliseconds(0);
+    } else {
+        // 去相关抖动：多个终端同时断线时重连时间分散，避免同时冲击服务端
+        long long base_ms = std::max(reconnect_base_milli_second_, 1);
+        long long cap_ms = std::max(static_cast<long long>(reconnect_interval_second_) * 1000LL, base_ms);
+        std::uniform_int_distribution<long long> distribution(base_ms, std::max<long long>(base_ms, backoff_.count() * 3));
+        backoff_ = std::chrono::milliseconds(std::min(cap_ms, distribution(backoff_random_)));
+    }
+    next_connect_time_ = std::chrono::steady_clock::now() + backoff_;
+    spdlog::info("MQTT客户端[{}]第[{}]次连接将在[{}]毫秒后进行", name_, connect_attempts_ + 1, backoff_.count());
+}
+
+bool MqttClient::check_network_up() {
+    bool is_network_up = is_network_up_.exchange(false);
+    if (!network_up_file_.empty()) {
+        long long mtime = file_mtime(network_up_file_);
+        if (mtime != network_up_file_mtime_) {
+            network_up_file_mtime_ = mtime;
+            is_network_up = is_network_up || mtime != 0;
+        }
+    }
+    if (!is_network_up) {
+        return false;
+    }
+    // 只重置退避，尝试次数保留用于统计，再次失败时从基础间隔重新退避
+    spdlog::info("MQTT客户端[{}]收到网络恢复通知，立即重连", name_);
+    backoff_ = std::chrono::milliseconds(0);
+    next_connect_time_ = std::chrono::steady_clock::now();
+    return true;
+}
+
+void MqttClient::wait_reconnect() {
+    while (is_started_ && !check_network_up()) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= next_connect_time_) {
+            return;
+        }
+        long long remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                next_connect_time_ - now).count() + 1;
+        // 配置了通知文件时至少每秒检查一次
+        if (!network_up_file_.empty()) {
+            remaining_ms = std::min(remaining_ms, 1000LL);
+        }
+        wait_wake(static_cast<int>(remaining_ms));
+    }
+}
+
+bool MqttClient::init_event_loop() {
+    if (epoll_fd_ >= 0) {
+        return true;
+    }
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (epoll_fd_ < 0 || wake_fd_ < 0 || timer_fd_ < 0) {
+        spdlog::error("MQTT客户端事件循环创建失败");
+        close_event_loop();
+        return false;
+    }
+    // 定时器创建后未启动，由arm_timer按最近的截止时间启动
+    timer_deadline_ = std::chrono::steady_clock::time_point::max();
+    struct epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = wake_fd_;
+    bool is_success = epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &event) == 0;
+    event.data.fd = timer_fd_;
+    is_success = is_success && epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, timer_fd_, &event) == 0;
+    if (!is_success) {
+        spdlog::error("MQTT客户端事件循环注册失败");
+        close_event_loop();
+        return false;
+    }
+    return true;
+}
+
+void MqttClient::arm_timer() {
+    auto deadline = std::chrono::steady_clock::time_point::max();
+    if (keepalive_ > 0) {
+        deadline = next_keepalive_time_;
+    }
+    if (connect_state_ == CONNECT_STATE_CONNECTING) {
+        deadline = std::min(deadline, connect_deadline_);
+    }
+    if (metrics_interval_second_ > 0) {
+        deadline = std::min(deadline, last_metrics_time_ + std::chrono::seconds(metrics_interval_second_));
+    }
+    if (deadline == timer_deadline_) {
+        return;
+    }
+    // steady_clock基于CLOCK_MONOTONIC，按绝对时间启动，已过期时立即触发；全为0会停止定时器
+    struct itimerspec timer_spec{};
+    if (deadline != std::chrono::steady_clock::time_point::max()) {
+        long long deadline_ns = std::max<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                deadline.time_since_epoch()).count(), 1);
+        timer_spec.it_value.tv_sec = static_cast<time_t>(deadline_ns / 1000000000LL);
+        timer_spec.it_value.tv_nsec = static_cast<long>(deadline_ns % 1000000000LL);
+    }
+    if (timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &timer_spec, nullptr) == 0) {
+        timer_deadline_ = deadline;
+    } else {
+        spdlog::warn("MQTT客户端[{}]定时器启动失败[{}]", name_, errno);
+    }
+}
+
+void MqttClient::close_event_loop() {
+    for (int *fd: {&epoll_fd_, &wake_fd_, &timer_fd_}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+    registered_socket_ = -1;
+}
+
+void MqttClient::wake() {
+    if (wake_fd_ >= 0) {
+        uint64_t value = 1;
+        if (::write(wake_fd_, &value, sizeof(value)) < 0) {
+            // 计数器将要溢出说明事件循环尚未处理之前的唤醒，无需再次唤醒
+        }
+    }
+}
+
+void MqttClient::wait_wake(int timeout_ms) {
+    struct pollfd wake_poll{};
+    wake_poll.fd = wake_fd_;
+    wake_poll.events = POLLIN;
+    if (::poll(&wake_poll, 1, timeout_ms) > 0) {
+        uint64_t value = 0;
+        if (::read(wake_fd_, &value, sizeof(value)) < 0) {
+            // 已被之前的读取清零
+        }
+    }
+}
+
+void MqttClient::poll_events() {
+    int sock = mosquitto_socket(mosq_);
+    if (sock < 0) {
+        on_disconnect(MOSQ_ERR_NO_CONN);
+        return;
+    }
+    // 有待发送数据时才关注可写事件，避免套接字空闲时持续唤醒
+    uint32_t events = EPOLLIN | (mosquitto_want_write(mosq_) ? static_cast<uint32_t>(EPOLLOUT) : 0);
+    if (sock != registered_socket_ || events != registered_events_) {
+        struct epoll_event event{};
+        event.events = events;
+        event.data.fd = sock;
+        int op = sock != registered_socket_ ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+        if (epoll_ctl(epoll_fd_, op, sock, &event) != 0 && !(op == EPOLL_CTL_ADD && errno == EEXIST &&
+                                                             epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, sock, &event) == 0)) {
+            spdlog::warn("MQTT套接字注册事件循环失败[{}]", errno);
+            return;
+        }
+        registered_socket_ = sock;
+        registered_events_ = events;
+    }
+    arm_timer();
+    struct epoll_event ready[3];
+    int count = epoll_wait(epoll_fd_, ready, 3, -1);
+    for (int i = 0; i < count; i++) {
+        uint64_t value = 0;
+        if (ready[i].data.fd == wake_fd_) {
+            if (::read(wake_fd_, &value, sizeof(value)) < 0) {
+                // 已被之前的读取清零
+            }
+        } else if (ready[i].data.fd == timer_fd_) {
+            if (::read(timer_fd_, &value, sizeof(value)) < 0) {
+                // 已被之前的读取清零
+            }
+            // 单次定时器触发后已停止，下一轮重新启动；连接超时与统计导出由网络线程主循环检查
+            timer_deadline_ = std::chrono::steady_clock::time_point::max();
+            auto now = std::chrono::steady_clock::now();
+            if (keepalive_ > 0 && now >= next_keepalive_time_) {
+                mosquitto_loop_misc(mosq_);
+                next_keepalive_time_ = now + std::chrono::milliseconds(keepalive_ * 500);
+            }
+        } else {
+            // 读写出错时libmosquitto会关闭套接字并回调on_disconnect
+            // TLS连接可能有数据缓存在SSL层，一次读到套接字无数据为止
+            if (ready[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+                mosquitto_loop_read(mosq_, 100);
+            }
+            if ((ready[i].events & EPOLLOUT) && mosquitto_socket(mosq_) >= 0) {
+                mosquitto_loop_write(mosq_, 1);
+            }
+        }
+    }
+}
+
+void MqttClient::flush_publishes() {
+    publish_batch_.clear();
+    publish_queue_.pop_all(publish_batch_);
+    for (auto &request: publish_batch_) {
+        publish_pending_.push_back(std::move(request));
+    }
+    publish_batch_.clear();
+    if (publish_pending_.empty()) {
+        return;
+    }
+    MqttPublishListener *listener = publish_listener_;
+    int sock = mosq_ != nullptr ? mosquitto_socket(mosq_) : -1;
+    if (!is_connected_ || sock < 0) {
+        std::unique_lock<std::mutex> lock(metrics_mutex_);
+        for (const auto &request: publish_pending_) {
+            topic_metrics(request.topic).failed++;
+        }
+        lock.unlock();
+        for (const auto &request: publish_pending_) {
+            publish_depth_.fetch_sub(1);
+            if (listener != nullptr) {
+                listener->on_publish_sent(request.token, 0, false);
+            }
+        }
+        publish_pending_.clear();
+        return;
+    }
+    // libmosquitto每个报文单独写入套接字，批量发布期间塞住套接字，由内核合并为尽量少的报文段
+    int cork = 1;
+    bool is_corked = publish_pending_.size() > 1 &&
+                     setsockopt(sock, IPPROTO_TCP, TCP_CORK, &cork, sizeof(cork)) == 0;
+    while (!publish_pending_.empty() && publish_inflight_.size() < send_maximum_) {
+        publish_request_t &request = publish_pending_.front();
+        int mid = 0;
+        int rc = publish_request(request, mid);
+        if (rc == MOSQ_ERR_SUCCESS) {
+            MqttTrace::get_instance().trace_publish(name_, mid, request.topic, request.qos, request.payload);
+        } else {
+            spdlog::warn("MQTT客户端[{}]发送消息至主题[{}]失败[{}]", name_, request.topic, rc);
+        }
+        {
+            std::lock_guard<std::mutex> lock(metrics_mutex_);
+            mqtt_topic_metrics_t &metrics = topic_metrics(request.topic);
+            if (rc == MOSQ_ERR_SUCCESS) {
+                metrics.sent++;
+                metrics.bytes_out += request.payload.size();
+                if (request.qos > 0) {
+                    publish_inflight_[mid] = {&metrics, request.submit_time};
+                }
+            } else {
+                metrics.failed++;
+            }
+        }
+        publish_depth_.fetch_sub(1);
+        uint64_t token = request.token;
+        publish_pending_.pop_front();
+        if (listener != nullptr) {
+            listener->on_publish_sent(token, rc == MOSQ_ERR_SUCCESS ? mid : 0, rc == MOSQ_ERR_SUCCESS);
+        }
+    }
+    if (is_corked) {
+        cork = 0;
+        setsockopt(sock, IPPROTO_TCP, TCP_CORK, &cork, sizeof(cork));
+    }
+}
+
+void MqttClient::drain_publishes() {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(stop_drain_milli_second_);
+    while (is_connected_) {
+        flush_publishes();
+        bool is_want_write = mosquitto_want_write(mosq_);
+        if (publish_pending_.empty() && publish_inflight_.empty() && !is_want_write) {
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        int sock = mosquitto_socket(mosq_);
+        if (now >= deadline || sock < 0) {
+            break;
+        }
+        int timeout_ms = static_cast<int>(std::min<long long>(
+                50, std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1));
+        struct pollfd socket_poll{sock, static_cast<short>(POLLIN | (is_want_write ? POLLOUT : 0)), 0};
+        if (::poll(&socket_poll, 1, timeout_ms) < 0 && errno != EINTR) {
+            break;
+        }
+        // 读写出错时libmosquitto会关闭套接字并回调on_disconnect
+        if (socket_poll.revents & (POLLIN | POLLERR | POLLHUP)) {
+            mosquitto_loop_read(mosq_, 100);
+        }
+        if ((socket_poll.revents & POLLOUT) && mosquitto_socket(mosq_) >= 0) {
+            mosquitto_loop_write(mosq_, 1);
+        }
+    }
+    if (!publish_pending_.empty() || !publish_inflight_.empty()) {
+        spdlog::warn("MQTT客户端[{}]停止时仍有未发布[{}]条未确认[{}]条消息", name_, publish_pending_.size(),
+                     publish_inflight_.size());
+    }
+}
+
+bool MqttClient::init_tls() {
+    if (ssl_ctx_ != nullptr) {
+        return true;
+    }
+    ssl_ctx_ = SSL_CTX_new(TLS_client_method());
+    if (ssl_ctx_ == nullptr) {
+        spdlog::error("MQTT客户端[{}]TLS上下文创建失败", name_);
+        return false;
+    }
+    SSL_CTX_set_app_data(ssl_ctx_, this);
+    // 只由本对象保存最近一次会话，不使用OpenSSL内部的会话缓存
+    SSL_CTX_set_session_cache_mode(ssl_ctx_, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ssl_ctx_, [](SSL *ssl, SSL_SESSION *session) -> int {
+        static_cast<MqttClient *>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)))->on_tls_session(session);
+        return 1;
+    });
+    // libmosquitto在连接内部创建SSL对象并立即握手，在首次握手开始、构造ClientHello之前设置待恢复的会话
+    SSL_CTX_set_info_callback(ssl_ctx_, [](const SSL *ssl, int where, int) {
+        if ((where & SSL_CB_HANDSHAKE_START) == 0 || SSL_get_session(ssl) != nullptr) {
+            return;
+        }
+        auto *client = static_cast<MqttClient *>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+        if (client->tls_session_ != nullptr) {
+            SSL_set_session(const_cast<SSL *>(ssl), client->tls_session_);
+        }
+    });
+    if (tls_session_file_.empty()) {
+        return true;
+    }
+    std::ifstream file(tls_session_file_, std::ios::binary);
+    std::vector<unsigned char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (buffer.empty()) {
+        return true;
+    }
+    const unsigned char *data = buffer.data();
+    SSL_SESSION *session = d2i_SSL_SESSION(nullptr, &data, static_cast<long>(buffer.size()));
+    if (session == nullptr || SSL_SESSION_is_resumable(session) != 1) {
+        spdlog::warn("MQTT客户端[{}]TLS会话文件[{}]无效", name_, tls_session_file_);
+        SSL_SESSION_free(session);
+        return true;
+    }
+    tls_session_ = session;
+    spdlog::info("MQTT客户端[{}]加载TLS会话[{}]", name_, tls_session_file_);
+    return true;
+}
+
+void MqttClient::on_tls_session(struct ssl_session_st *session) {
+    if (tls_session_ != nullptr) {
+        SSL_SESSION_free(tls_session_);
+    }
+    tls_session_ = session;
+    if (tls_session_file_.empty()) {
+        return;
+    }
+    int length = i2d_SSL_SESSION(session, nullptr);
+    if (length <= 0) {
+        return;
+    }
+    std::vector<unsigned char> buffer(static_cast<size_t>(length));
+    unsigned char *data = buffer.data();
+    i2d_SSL_SESSION(session, &data);
+    // 会话包含主密钥，只允许本用户读写
+    std::string temp_path = tls_session_file_ + ".tmp";
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        spdlog::warn("MQTT客户端[{}]无法创建TLS会话文件[{}]", name_, temp_path);
+        return;
+    }
+    bool is_success = ::write(fd, buffer.data(), buffer.size()) == static_cast<ssize_t>(buffer.size());
+    ::close(fd);
+    if (!is_success || std::rename(temp_path.c_str(), tls_session_file_.c_str()) != 0) {
+        spdlog::warn("MQTT客户端[{}]保存TLS会话文件[{}]失败", name_, tls_session_file_);
+        std::remove(temp_path.c_str());
+    }
+}
+
+int MqttClient::publish_request(const publish_request_t &request, int &mid) {
+    mosquitto_property *properties = nullptr;
+    const char *topic = request.topic.c_str();
+    bool is_new_alias = false;
+    if (use_mqtt5_) {
+        if (request.expiry_second > 0) {
+            mosquitto_property_add_int32(&properties, MQTT_PROP_MESSAGE_EXPIRY_INTERVAL, request.expiry_second);
+        }
+        if (topic_alias_maximum_ > 0) {
+            auto it = topic_aliases_.find(request.topic);
+            if (it != topic_aliases_.end()) {
+                // 已建立别名的主题只发送别名，主题为空
+                mosquitto_property_add_int16(&properties, MQTT_PROP_TOPIC_ALIAS, it->second);
+                topic = "";
+            } else if (topic_aliases_.size() < topic_alias_maximum_) {
+                // 首次发送时同时携带主题与别名以建立映射
+                uint16_t alias = static_cast<uint16_t>(topic_aliases_.size() + 1);
+                mosquitto_property_add_int16(&properties, MQTT_PROP_TOPIC_ALIAS, alias);
+                topic_aliases_[request.topic] = alias;
+                is_new_alias = true;
+            }
+        }
+    }
+    int rc = mosquitto_publish_v5(mosq_, &mid, topic, static_cast<int>(request.payload.size()),
+                                  request.payload.data(), request.qos, false, properties);
+    mosquitto_property_free_all(&properties);
+    if (rc != MOSQ_ERR_SUCCESS && is_new_alias) {
+        topic_aliases_.erase(request.topic);
+    }
+    return rc;
+}
+
 bool MqttClient::connect() {
     spdlog::info("重置客户端ID");
-    int rc = this->reinitialise(client_id_.c_str(), true);
+    int rc = mosq_ == nullptr ? MOSQ_ERR_SUCCESS : mosquitto_reinitialise(mosq_, client_id_.c_str(), true, this);
+    if (mosq_ == nullptr) {
+        mosq_ = mosquitto_new(client_id_.c_str(), true, this);
+        rc = mosq_ != nullptr ? MOSQ_ERR_SUCCESS : MOSQ_ERR_NOMEM;
+    }
     if (rc != MOSQ_ERR_SUCCESS) {
         return false;
     }
+    set_callbacks();
+    if (use_mqtt5_) {
+        mosquitto_int_option(mosq_, MOSQ_OPT_PROTOCOL_VERSION, MQTT_PROTOCOL_V5);
+    }
     spdlog::info("设置用户名密码");
-    rc = this->username_pw_set(username_.c_str(), password_.c_str());
+    rc = mosquitto_username_pw_set(mosq_, username_.c_str(), password_.c_str());
     if (rc != MOSQ_ERR_SUCCESS) {
         return false;
     }
-    spdlog::info("连接MQTT[{}:{}]", server_host_, server_port_);
-    rc = mosquittopp::connect(server_host_.c_str(), server_port_, keepalive_);
+    if (use_ssl_) {
+        if (!init_tls()) {
+            return false;
+        }
+        // 使用自有TLS上下文以跨重连保存会话，证书加载与主机名校验仍由libmosquitto按默认方式设置
+        mosquitto_void_option(mosq_, MOSQ_OPT_SSL_CTX, ssl_ctx_);
+        mosquitto_int_option(mosq_, MOSQ_OPT_SSL_CTX_WITH_DEFAULTS, 1);
+        rc = mosquitto_tls_set(mosq_, ca_file_.c_str(), nullptr, cert_file_.empty() ? nullptr : cert_file_.c_str(),
+                               key_file_.empty() ? nullptr : key_file_.c_str(), nullptr);
+        if (rc != MOSQ_ERR_SUCCESS) {
+            spdlog::error("MQTT客户端[{}]TLS配置失败[{}]", name_, rc);
+            return false;
+        }
+    }
+    // 在途上限由发布队列控制，libmosquitto内部不再另行排队（MQTT v5时仍以服务端接收上限为准）
+    mosquitto_int_option(mosq_, MOSQ_OPT_SEND_MAXIMUM,
+                         static_cast<int>(std::max<size_t>(1, std::min<size_t>(max_inflight_messages_, 65535))));
+    spdlog::info("MQTT客户端[{}]连接MQTT[{}:{}]", name_, server_host_, server_port_);
+    auto connect_time = std::chrono::steady_clock::now();
+    rc = mosquitto_connect(mosq_, server_host_.c_str(), server_port_, keepalive_);
+    spdlog::info("MQTT客户端[{}]建立连接耗时[{}]毫秒", name_, std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - connect_time).count());
     if (rc != MOSQ_ERR_SUCCESS) {
-        spdlog::info("连接MQTT失败");
+        spdlog::info("MQTT客户端[{}]连接MQTT失败", name_);
         return false;
     }
     return true;
@@ -236,13 +903,77 @@ bool MqttClient::subscribe_topic(int &mid, const std::string &topic, MqttMessage
     if (topic.empty()) {
         return false;
     }
-    int rc = this->subscribe(&mid, topic.c_str(), qos);
+    // 先添加路由，保证订阅成功后立即到达的消息能够被处理
+    if (!topic_router_.add(topic, handler)) {
+        spdlog::warn("主题[{}]路由添加失败", topic);
+        return false;
+    }
+    int rc = mosquitto_subscribe(mosq_, &mid, topic.c_str(), qos);
     spdlog::info("订阅[{}]主题[{}]QOS[{}]", mid, topic, qos);
     if (rc != MOSQ_ERR_SUCCESS) {
         spdlog::warn("订阅[{}]主题[{}]失败[{}]", mid, topic, rc);
         return false;
     }
-    message_handler_[topic] = &handler;
-    cv_loop_.notify_all();
+    wake();
     return true;
 }
+
+mqtt_topic_metrics_t &MqttClient::topic_metrics(const std::string &topic) {
+    auto it = topic_metrics_.find(topic);
+    if (it == topic_metrics_.end()) {
+        it = topic_metrics_.emplace(topic, mqtt_topic_metrics_t()).first;
+    }
+    return it->second;
+}
+
+void MqttClient::export_metrics() {
+    auto now = std::chrono::steady_clock::now();
+    if (metrics_interval_second_ <= 0 || now - last_metrics_time_ < std::chrono::seconds(metrics_interval_second_)) {
+        return;
+    }
+    last_metrics_time_ = now;
+    json topics = json::object();
+    {
+        std::lock_guard<std::mutex> lock(metrics_mutex_);
+        for (auto &entry: topic_metrics_) {
+            mqtt_topic_metrics_t &metrics = entry.second;
+            RsmsLatencyHistogram &latency = metrics.latency;
+            spdlog::info("MQTT客户端[{}]主题[{}]发布[{}]确认[{}]失败[{}]拒绝[{}]丢弃[{}]接收[{}]发送字节[{}]接收字节[{}]"
+                         "确认时延P50[{:.1f}]P99[{:.1f}]最大[{:.1f}]毫秒", name_, entry.first, metrics.sent,
+                         metrics.acked, metrics.failed, metrics.rejected, metrics.dropped, metrics.received,
+                         metrics.bytes_out, metrics.bytes_in, latency.percentile(0.5) / 1000.0,
+                         latency.percentile(0.99) / 1000.0, latency.max() / 1000.0);
+            topics[entry.first] = {
+                    {"sent",        metrics.sent},
+                    {"acked",       metrics.acked},
+                    {"failed",      metrics.failed},
+                    {"rejected",    metrics.rejected},
+                    {"dropped",     metrics.dropped},
+                    {"received",    metrics.received},
+                    {"bytes_out",   metrics.bytes_out},
+                    {"bytes_in",    metrics.bytes_in},
+                    {"latency_us",  {
+                                            {"count", latency.count()},
+                                            {"mean", latency.mean()},
+                                            {"p50", latency.percentile(0.5)},
+                                            {"p90", latency.percentile(0.9)},
+                                            {"p99", latency.percentile(0.99)},
+                                            {"p999", latency.percentile(0.999)},
+                                            {"max", latency.max()}
+                                    }}
+            };
+            latency.reset();
+        }
+    }
+    if (metrics_topic_.empty() || !is_connected_) {
+        return;
+    }
+    json metrics_json = {
+            {"client",    client_id_},
+            {"timestamp", hwyz::Utils::get_current_timestamp_ms()},
+            {"interval",  metrics_interval_second_},
+            {"topics",    topics}
+    };
+    std::string text = metrics_json.dump();
+    publish(metrics_topic_, std::vector<uint8_t>(text.begin(), text.end()), 0);
+}
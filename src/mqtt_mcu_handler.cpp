@@ -1,17 +1,70 @@
 //
 // Created by hwyz_leo on 2025/8/13.
 //
+#include <algorithm>
+
 #include "spdlog/spdlog.h"
 
 #include "mqtt_mcu_handler.h"
 #include "rsms_data_v1.pb.h"
 #include "rsms_signal_cache.h"
 
+MqttMcuFormatHandler::MqttMcuFormatHandler(MqttMcuHandler &owner, handle_func_t handle_func)
+        : owner_(owner), handle_func_(handle_func) {}
+
+void MqttMcuFormatHandler::handle(std::string payload) {
+    (owner_.*handle_func_)(payload);
+}
+
 MqttMcuHandler &MqttMcuHandler::get_instance() {
     static MqttMcuHandler instance;
     return instance;
 }
 
+MqttMessageHandler &MqttMcuHandler::format_handler(mcu_format_t format) {
+    return format_handlers_[format];
+}
+
+void MqttMcuHandler::handle_delta(const std::string &payload) {
+    if (!delta_.ParseFromString(payload)) {
+        spdlog::error("解析MCU国标增量数据失败");
+        return;
+    }
+    int present_count = 0;
+    for (int word = 0; word < delta_.presence_size(); word++) {
+        present_count += __builtin_popcountll(delta_.presence(word));
+    }
+    if (present_count != delta_.values_size()) {
+        spdlog::error("MCU国标增量数据[{}]位图信号数[{}]与信号值数[{}]不一致",
+                      delta_.sequence(), present_count, delta_.values_size());
+        return;
+    }
+    if (delta_.keyframe()) {
+        has_keyframe_ = true;
+    } else if (!has_keyframe_) {
+        spdlog::debug("尚未收到MCU国标关键帧，仅更新增量数据[{}]中的信号", delta_.sequence());
+    } else if (delta_.sequence() != last_sequence_ + 1) {
+        spdlog::warn("MCU国标增量数据丢帧[{}->{}]，等待下一关键帧", last_sequence_, delta_.sequence());
+    }
+    last_sequence_ = delta_.sequence();
+
+    RsmsSignalCache &instance = RsmsSignalCache::get_instance();
+    int value_index = 0;
+    for (int word = 0; word < delta_.presence_size(); word++) {
+        uint64_t bits = delta_.presence(word);
+        while (bits != 0) {
+            size_t index = static_cast<size_t>(word) * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            uint32_t value = delta_.values(value_index++);
+            // 忽略本端信号定义表中尚未定义的信号
+            if (index < kSignalDefineCount) {
+                instance.set_value(kSignalDefines[index].key, kSignalDefines[index].type, value);
+            }
+        }
+    }
+    spdlog::debug("写入增量信号[{}]个", present_count);
+}
+
 void MqttMcuHandler::handle(std::string payload) {
     tbox::mcu::rsms::v1::RsmsData rsms_data;
     if (!rsms_data.ParseFromString(payload)) {
@@ -146,4 +199,131 @@ void MqttMcuHandler::handle(std::string payload) {
     instance.set_word(SIGNAL_BATTERY1_PROBE15_TEMPERATURE,
                       rsms_data.battery_temperature().battery_temperature_list(0).temperatures(14));
     spdlog::debug("写入信号缓存");
-}
\ No newline at end of file
+}
+
+void MqttMcuHandler::handle_fast(const std::string &payload) {
+    if (!fast_.ParseFromString(payload)) {
+        spdlog::error("解析MCU国标高频数据失败");
+        return;
+    }
+    RsmsSignalCache &instance = RsmsSignalCache::get_instance();
+    instance.set_word(SIGNAL_SPEED, fast_.speed());
+    instance.set_word(SIGNAL_TOTAL_VOLTAGE, fast_.total_voltage());
+    instance.set_word(SIGNAL_TOTAL_CURRENT, fast_.total_current());
+    instance.set_byte(SIGNAL_SOC, fast_.soc());
+    instance.set_byte(SIGNAL_GEAR, fast_.gear());
+    instance.set_boolean(SIGNAL_DRIVING, fast_.driving());
+    instance.set_boolean(SIGNAL_BRAKING, fast_.braking());
+    instance.set_byte(SIGNAL_ACCELERATOR_PEDAL_POSITION, fast_.accelerator_pedal_position());
+    instance.set_byte(SIGNAL_BRAKE_PEDAL_POSITION, fast_.brake_pedal_position());
+    // 信号缓存目前只有两个驱动电机，电机2各信号与电机1相差20
+    int motor_count = std::min(fast_.motor_state_size(), 2);
+    for (int i = 0; i < motor_count; i++) {
+        int offset = i * (SIGNAL_DM2_STATE - SIGNAL_DM1_STATE);
+        instance.set_byte(SIGNAL_DM1_STATE + offset, fast_.motor_state(i));
+        if (i < fast_.motor_controller_temperature_size()) {
+            instance.set_byte(SIGNAL_DM1_CONTROLLER_TEMPERATURE + offset, fast_.motor_controller_temperature(i));
+        }
+        if (i < fast_.motor_speed_size()) {
+            instance.set_word(SIGNAL_DM1_SPEED + offset, fast_.motor_speed(i));
+        }
+        if (i < fast_.motor_torque_size()) {
+            instance.set_word(SIGNAL_DM1_TORQUE + offset, fast_.motor_torque(i));
+        }
+        if (i < fast_.motor_temperature_size()) {
+            instance.set_byte(SIGNAL_DM1_TEMPERATURE + offset, fast_.motor_temperature(i));
+        }
+        if (i < fast_.motor_controller_input_voltage_size()) {
+            instance.set_word(SIGNAL_DM1_CONTROLLER_INPUT_VOLTAGE + offset, fast_.motor_controller_input_voltage(i));
+        }
+        if (i < fast_.motor_controller_dc_bus_current_size()) {
+            instance.set_word(SIGNAL_DM1_CONTROLLER_DC_BUS_CURRENT + offset, fast_.motor_controller_dc_bus_current(i));
+        }
+    }
+}
+
+void MqttMcuHandler::handle_position(const std::string &payload) {
+    if (!position_.ParseFromString(payload)) {
+        spdlog::error("解析MCU国标位置数据失败");
+        return;
+    }
+    RsmsSignalCache &instance = RsmsSignalCache::get_instance();
+    instance.set_boolean(SIGNAL_POSITION_VALID, (position_.state() & 0x01) == 0);
+    instance.set_boolean(SIGNAL_SOUTH_LATITUDE, (position_.state() & 0x02) != 0);
+    instance.set_boolean(SIGNAL_WEST_LONGITUDE, (position_.state() & 0x04) != 0);
+    instance.set_dword(SIGNAL_LONGITUDE, position_.longitude());
+    instance.set_dword(SIGNAL_LATITUDE, position_.latitude());
+}
+
+void MqttMcuHandler::handle_cell(const std::string &payload) {
+    if (!cell_.ParseFromString(payload)) {
+        spdlog::error("解析MCU国标单体电压数据失败");
+        return;
+    }
+    // 信号缓存目前只有可充电储能子系统1
+    if (cell_.sn() != 1) {
+        return;
+    }
+    RsmsSignalCache &instance = RsmsSignalCache::get_instance();
+    instance.set_word(SIGNAL_BATTERY1_VOLTAGE, cell_.voltage());
+    instance.set_word(SIGNAL_BATTERY1_CURRENT, cell_.current());
+    instance.set_word(SIGNAL_BATTERY1_CELL_COUNT, cell_.cell_count());
+    const std::string &cell_voltages = cell_.cell_voltages();
+    const auto *bytes = reinterpret_cast<const uint8_t *>(cell_voltages.data());
+    int start = cell_.frame_start_cell_sn() > 0 ? static_cast<int>(cell_.frame_start_cell_sn()) - 1 : 0;
+    int max_cells = SIGNAL_BATTERY1_CELL16_VOLTAGE - SIGNAL_BATTERY1_CELL1_VOLTAGE + 1;
+    int count = static_cast<int>(cell_voltages.size() / 2);
+    for (int i = 0; i < count && start + i < max_cells; i++) {
+        uint16_t voltage = static_cast<uint16_t>((bytes[i * 2] << 8) | bytes[i * 2 + 1]);
+        instance.set_word(SIGNAL_BATTERY1_CELL1_VOLTAGE + start + i, voltage);
+    }
+}
+
+void MqttMcuHandler::handle_slow(const std::string &payload) {
+    if (!slow_.ParseFromString(payload)) {
+        spdlog::error("解析MCU国标低频数据失败");
+        return;
+    }
+    RsmsSignalCache &instance = RsmsSignalCache::get_instance();
+    instance.set_byte(SIGNAL_VEHICLE_STATE, slow_.vehicle_state());
+    instance.set_byte(SIGNAL_CHARGING_STATE, slow_.charging_state());
+    instance.set_byte(SIGNAL_RUNNING_MODE, slow_.running_mode());
+    instance.set_dword(SIGNAL_TOTAL_ODOMETER, slow_.total_odometer());
+    instance.set_byte(SIGNAL_DCDC_STATE, slow_.dcdc_state());
+    instance.set_word(SIGNAL_INSULATION_RESISTANCE, slow_.insulation_resistance());
+    if (slow_.battery_sn() == 1) {
+        const std::string &temperatures = slow_.probe_temperatures();
+        int max_probes = SIGNAL_BATTERY1_PROBE15_TEMPERATURE - SIGNAL_BATTERY1_PROBE1_TEMPERATURE + 1;
+        int count = std::min(static_cast<int>(temperatures.size()), max_probes);
+        instance.set_word(SIGNAL_BATTERY1_PROBE_COUNT, static_cast<uint16_t>(temperatures.size()));
+        for (int i = 0; i < count; i++) {
+            instance.set_byte(SIGNAL_BATTERY1_PROBE1_TEMPERATURE + i, static_cast<uint8_t>(temperatures[i]));
+        }
+    }
+    // 极值数据按国标字段顺序：子系统号、单体代号、电压值为一组，温度同理
+    static const signal_define_t extremum_defines[] = {
+            {SIGNAL_MAX_VOLTAGE_BATTERY_DEVICE_NO, SIGNAL_TYPE_BYTE},
+            {SIGNAL_MAX_VOLTAGE_CELL_NO, SIGNAL_TYPE_BYTE},
+            {SIGNAL_CELL_MAX_VOLTAGE, SIGNAL_TYPE_WORD},
+            {SIGNAL_MIN_VOLTAGE_BATTERY_DEVICE_NO, SIGNAL_TYPE_BYTE},
+            {SIGNAL_MIN_VOLTAGE_CELL_NO, SIGNAL_TYPE_BYTE},
+            {SIGNAL_CELL_MIN_VOLTAGE, SIGNAL_TYPE_WORD},
+            {SIGNAL_MAX_TEMPERATURE_DEVICE_NO, SIGNAL_TYPE_BYTE},
+            {SIGNAL_MAX_TEMPERATURE_PROBE_NO, SIGNAL_TYPE_BYTE},
+            {SIGNAL_MAX_TEMPERATURE, SIGNAL_TYPE_BYTE},
+            {SIGNAL_MIN_TEMPERATURE_DEVICE_NO, SIGNAL_TYPE_BYTE},
+            {SIGNAL_MIN_TEMPERATURE_PROBE_NO, SIGNAL_TYPE_BYTE},
+            {SIGNAL_MIN_TEMPERATURE, SIGNAL_TYPE_BYTE},
+    };
+    int extremum_count = std::min(slow_.extremum_size(),
+                                  static_cast<int>(sizeof(extremum_defines) / sizeof(extremum_defines[0])));
+    for (int i = 0; i < extremum_count; i++) {
+        instance.set_value(extremum_defines[i].key, extremum_defines[i].type, slow_.extremum(i));
+    }
+    instance.set_byte(SIGNAL_MAX_ALARM_LEVEL, slow_.max_alarm_level());
+    instance.set_dword(SIGNAL_ALARM_FLAG, slow_.alarm_flag());
+    instance.set_byte(SIGNAL_BATTERY_FAULT_COUNT, slow_.battery_fault_list_size());
+    instance.set_byte(SIGNAL_DRIVE_MOTOR_FAULT_COUNT, slow_.drive_motor_fault_list_size());
+    instance.set_byte(SIGNAL_ENGINE_FAULT_COUNT, slow_.engine_fault_list_size());
+    instance.set_byte(SIGNAL_OTHER_FAULT_COUNT, slow_.other_fault_list_size());
+}
@@ -0,0 +1,17 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+#include "spdlog/spdlog.h"
+
+#include "mqtt_client.h"
+#include "mqtt_network_up_handler.h"
+
+MqttNetworkUpHandler &MqttNetworkUpHandler::get_instance() {
+    static MqttNetworkUpHandler instance;
+    return instance;
+}
+
+void MqttNetworkUpHandler::handle(std::string payload) {
+    spdlog::info("收到网络恢复[{}]消息", payload);
+    MqttClient::get_uplink().notify_network_up();
+}
@@ -0,0 +1,209 @@
+//
+// Created by hwyz_leo on 2025/8/26.
+//
+#include <cstring>
+
+#include "mqtt_topic_router.h"
+
+MqttTopicRouter::MqttTopicRouter() = default;
+
+MqttTopicRouter::~MqttTopicRouter() = default;
+
+bool MqttTopicRouter::add(const std::string &topic_filter, MqttMessageHandler &handler) {
+    if (!is_valid_filter(topic_filter)) {
+        return false;
+    }
+    if (topic_filter.find_first_of("+#") == std::string::npos) {
+        size_t topic_hash = hash_topic(topic_filter.c_str(), topic_filter.size());
+        for (auto &exact_route: exact_routes_) {
+            if (exact_route.topic_hash == topic_hash && exact_route.topic == topic_filter) {
+                exact_route.handler = &handler;
+                return true;
+            }
+        }
+        exact_routes_.push_back({topic_filter, topic_hash, &handler});
+        return true;
+    }
+    node_t *node = &root_;
+    size_t start = 0;
+    while (true) {
+        size_t end = topic_filter.find('/', start);
+        std::string level = topic_filter.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        std::unique_ptr<node_t> *slot = nullptr;
+        if (level == "+") {
+            slot = &node->plus;
+        } else if (level == "#") {
+            slot = &node->hash;
+        } else {
+            for (auto &child: node->children) {
+                if (child->level == level) {
+                    slot = &child;
+                    break;
+                }
+            }
+            if (slot == nullptr) {
+                node->children.emplace_back(new node_t());
+                slot = &node->children.back();
+            }
+        }
+        if (!*slot) {
+            slot->reset(new node_t());
+        }
+        (*slot)->level = level;
+        node = slot->get();
+        if (end == std::string::npos) {
+            break;
+        }
+        start = end + 1;
+    }
+    if (node->handler == nullptr) {
+        wildcard_count_++;
+    }
+    node->handler = &handler;
+    return true;
+}
+
+bool MqttTopicRouter::remove(const std::string &topic_filter) {
+    if (topic_filter.find_first_of("+#") == std::string::npos) {
+        for (auto it = exact_routes_.begin(); it != exact_routes_.end(); ++it) {
+            if (it->topic == topic_filter) {
+                exact_routes_.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+    node_t *node = &root_;
+    size_t start = 0;
+    while (node != nullptr) {
+        size_t end = topic_filter.find('/', start);
+        std::string level = topic_filter.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        node_t *next = nullptr;
+        if (level == "+") {
+            next = node->plus.get();
+        } else if (level == "#") {
+            next = node->hash.get();
+        } else {
+            for (auto &child: node->children) {
+                if (child->level == level) {
+                    next = child.get();
+                    break;
+                }
+            }
+        }
+        node = next;
+        if (end == std::string::npos) {
+            break;
+        }
+        start = end + 1;
+    }
+    if (node == nullptr || node->handler == nullptr) {
+        return false;
+    }
+    node->handler = nullptr;
+    wildcard_count_--;
+    return true;
+}
+
+void MqttTopicRouter::clear() {
+    exact_routes_.clear();
+    root_.children.clear();
+    root_.plus.reset();
+    root_.hash.reset();
+    root_.handler = nullptr;
+    wildcard_count_ = 0;
+}
+
+MqttMessageHandler *MqttTopicRouter::route(const char *topic) const {
+    if (topic == nullptr) {
+        return nullptr;
+    }
+    size_t length = std::strlen(topic);
+    size_t topic_hash = hash_topic(topic, length);
+    for (const auto &exact_route: exact_routes_) {
+        if (exact_route.topic_hash == topic_hash && exact_route.topic.size() == length &&
+            std::memcmp(exact_route.topic.data(), topic, length) == 0) {
+            return exact_route.handler;
+        }
+    }
+    if (wildcard_count_ == 0) {
+        return nullptr;
+    }
+    return match(&root_, topic, true);
+}
+
+size_t MqttTopicRouter::size() const {
+    return exact_routes_.size() + wildcard_count_;
+}
+
+bool MqttTopicRouter::is_valid_filter(const std::string &topic_filter) {
+    if (topic_filter.empty()) {
+        return false;
+    }
+    size_t start = 0;
+    while (true) {
+        size_t end = topic_filter.find('/', start);
+        size_t length = (end == std::string::npos ? topic_filter.size() : end) - start;
+        for (size_t i = start; i < start + length; i++) {
+            char c = topic_filter[i];
+            if ((c == '+' || c == '#') && length != 1) {
+                return false;
+            }
+        }
+        if (length == 1 && topic_filter[start] == '#' && end != std::string::npos) {
+            // 多层通配符只能位于最后一层
+            return false;
+        }
+        if (end == std::string::npos) {
+            return true;
+        }
+        start = end + 1;
+    }
+}
+
+size_t MqttTopicRouter::hash_topic(const char *topic, size_t length) {
+    size_t topic_hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        topic_hash ^= static_cast<unsigned char>(topic[i]);
+        topic_hash *= 16777619u;
+    }
+    return topic_hash;
+}
+
+MqttMessageHandler *MqttTopicRouter::match(const node_t *node, const char *level, bool is_first_level) {
+    if (level == nullptr) {
+        // 主题已匹配完，a/#同样匹配a
+        if (node->handler != nullptr) {
+            return node->handler;
+        }
+        if (node->hash && node->hash->handler != nullptr) {
+            return node->hash->handler;
+        }
+        return nullptr;
+    }
+    const char *end = std::strchr(level, '/');
+    size_t length = end == nullptr ? std::strlen(level) : static_cast<size_t>(end - level);
+    const char *next = end == nullptr ? nullptr : end + 1;
+    for (const auto &child: node->children) {
+        if (child->level.size() == length && std::memcmp(child->level.data(), level, length) == 0) {
+            MqttMessageHandler *handler = match(child.get(), next, false);
+            if (handler != nullptr) {
+                return handler;
+            }
+        }
+    }
+    // 以$开头的系统主题不匹配首层通配符
+    if (is_first_level && *level == '$') {
+        return nullptr;
+    }
+    if (node->plus) {
+        MqttMessageHandler *handler = match(node->plus.get(), next, false);
+        if (handler != nullptr) {
+            return handler;
+        }
+    }
+    if (node->hash && node->hash->handler != nullptr) {
+        return node->hash->handler;
+    }
+    return nullptr;
+}
@@ -0,0 +1,139 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+#include <fstream>
+
+#include "utils.h"
+
+#include "mqtt_trace.h"
+
+MqttTrace &MqttTrace::get_instance() {
+    static MqttTrace instance;
+    return instance;
+}
+
+bool MqttTrace::load_config(const YAML::Node &config) {
+    spdlog::info("加载MQTT收发跟踪配置信息");
+    if (config["trace"]) {
+        if (config["trace"]["level"]) {
+            std::string level = config["trace"]["level"].as<std::string>();
+            level_ = spdlog::level::from_str(level);
+            if (level_ == spdlog::level::off && level != "off") {
+                spdlog::error("MQTT收发跟踪级别[{}]无效", level);
+                return false;
+            }
+        }
+        if (config["trace"]["queue-size"]) {
+            queue_size_ = config["trace"]["queue-size"].as<size_t>();
+        }
+        if (config["trace"]["sample-every"]) {
+            sample_every_ = config["trace"]["sample-every"].as<uint64_t>();
+        }
+        if (config["trace"]["sample-topics"]) {
+            for (const auto &topic: config["trace"]["sample-topics"]) {
+                sample_topics_.insert(topic.as<std::string>());
+            }
+        }
+        if (config["trace"]["sample-ring-size"]) {
+            sample_ring_size_ = config["trace"]["sample-ring-size"].as<size_t>();
+        }
+        if (config["trace"]["sample-file"]) {
+            sample_file_ = config["trace"]["sample-file"].as<std::string>();
+        }
+        if (queue_size_ == 0 || sample_ring_size_ == 0) {
+            spdlog::error("MQTT收发跟踪队列长度[{}]采样条数[{}]无效", queue_size_, sample_ring_size_);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MqttTrace::start() {
+    if (is_started_) {
+        return true;
+    }
+    spdlog::info("启动MQTT收发跟踪");
+    // 沿用默认日志的输出位置与格式，收发跟踪级别单独控制
+    std::shared_ptr<spdlog::logger> default_logger = spdlog::default_logger();
+    thread_pool_ = std::make_shared<spdlog::details::thread_pool>(queue_size_, 1);
+    logger_ = std::make_shared<spdlog::async_logger>("mqtt-trace", default_logger->sinks().begin(),
+                                                     default_logger->sinks().end(), thread_pool_,
+                                                     spdlog::async_overflow_policy::overrun_oldest);
+    logger_->set_level(level_);
+    sample_sink_ = std::make_shared<spdlog::sinks::ringbuffer_sink_mt>(sample_ring_size_);
+    sample_logger_ = std::make_shared<spdlog::async_logger>("mqtt-sample", sample_sink_, thread_pool_,
+                                                            spdlog::async_overflow_policy::overrun_oldest);
+    is_started_ = true;
+    return true;
+}
+
+void MqttTrace::stop() {
+    if (!is_started_) {
+        return;
+    }
+    spdlog::info("停止MQTT收发跟踪");
+    is_started_ = false;
+    // 线程池析构时输出队列中剩余的日志并结束日志线程，之后环形缓冲中的采样完整
+    logger_.reset();
+    sample_logger_.reset();
+    thread_pool_.reset();
+    if (!sample_file_.empty()) {
+        std::vector<std::string> samples = get_samples();
+        std::ofstream file(sample_file_, std::ios::trunc);
+        for (const auto &sample: samples) {
+            file << sample;
+        }
+        spdlog::info("保存MQTT载荷采样[{}]条到[{}]", samples.size(), sample_file_);
+    }
+}
+
+void MqttTrace::trace_publish(const std::string &client, int mid, const std::string &topic, int qos,
+                              const std::vector<uint8_t> &payload) {
+    if (!is_started_) {
+        return;
+    }
+    if (logger_->should_log(spdlog::level::debug)) {
+        logger_->debug("MQTT客户端[{}]发送[{}]消息至主题[{}]QOS[{}]长度[{}]", client, mid, topic, qos, payload.size());
+    }
+    if (should_sample(topic)) {
+        sample_logger_->info("发送[{}][{}][{}]{}", client, mid, topic, hwyz::Utils::bytes_to_hex(payload, true));
+    }
+}
+
+void MqttTrace::trace_ack(const std::string &client, int mid) {
+    if (is_started_ && logger_->should_log(spdlog::level::debug)) {
+        logger_->debug("MQTT客户端[{}]发送[{}]消息成功", client, mid);
+    }
+}
+
+void MqttTrace::trace_receive(const std::string &client, const char *topic, const void *payload, size_t length) {
+    if (!is_started_) {
+        return;
+    }
+    if (logger_->should_log(spdlog::level::debug)) {
+        logger_->debug("MQTT客户端[{}]收到主题[{}]消息长度[{}]", client, topic, length);
+    }
+    // 未开启采样时不为主题构造字符串
+    if (sample_every_ == 0 && sample_topics_.empty()) {
+        return;
+    }
+    if (should_sample(topic)) {
+        const uint8_t *data = static_cast<const uint8_t *>(payload);
+        sample_logger_->info("接收[{}][{}]{}", client, topic,
+                             hwyz::Utils::bytes_to_hex(std::vector<uint8_t>(data, data + length), true));
+    }
+}
+
+std::vector<std::string> MqttTrace::get_samples() {
+    if (!sample_sink_) {
+        return {};
+    }
+    return sample_sink_->last_formatted();
+}
+
+bool MqttTrace::should_sample(const std::string &topic) {
+    if (sample_every_ > 0 && message_count_.fetch_add(1, std::memory_order_relaxed) % sample_every_ == 0) {
+        return true;
+    }
+    return !sample_topics_.empty() && sample_topics_.count(topic) > 0;
+}
@@ -0,0 +1,29 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+#include "nlohmann/json.hpp"
+#include "spdlog/spdlog.h"
+
+#include "mqtt_tsp_reissue_handler.h"
+#include "rsms_client.h"
+
+using json = nlohmann::json;
+
+MqttTspReissueHandler &MqttTspReissueHandler::get_instance() {
+    static MqttTspReissueHandler instance;
+    return instance;
+}
+
+void MqttTspReissueHandler::handle(std::string payload) {
+    spdlog::info("收到TSP按时间范围补发[{}]消息", payload);
+    json request = json::parse(payload, nullptr, false);
+    if (request.is_discarded() || !request.is_object() || !request.contains("start_time") ||
+        !request.contains("end_time") || !request["start_time"].is_number_integer() ||
+        !request["end_time"].is_number_integer()) {
+        spdlog::warn("按时间范围补发消息格式错误");
+        return;
+    }
+    // 网络线程只登记时间范围，由补发线程读取存储并提交
+    RsmsClient::get_instance().request_time_range(request["start_time"].get<long long>(),
+                                                  request["end_time"].get<long long>());
+}
@@ -9,9 +9,21 @@
 #include "utils.h"
 
 #include "rsms_client.h"
+#include "rsms_reissue_codec.h"
+#include "rsms_reissue_ring.h"
+#include "rsms_reissue_wal.h"
 #include "rsms_signal_cache.h"
 #include "mqtt_client.h"
 
+namespace {
+// 按时间范围补发的数据标识位，与存储序号合并为回调标识，区分同一序号的顺序补发
+const uint64_t kRangeReissueTag = 1ULL << 63;
+// 按时间范围补发每次读取存储的数量
+const size_t kRangeReadCount = 100;
+// 按保留时间清理补发数据的间隔秒数
+const long long kRetentionTrimIntervalSecond = 60;
+}
+
 RsmsClient &RsmsClient::get_instance() {
     static RsmsClient instance;
     return instance;
@@ -32,6 +44,94 @@ bool RsmsClient::init() {
     return true;
 }
 
+bool RsmsClient::load_config(const YAML::Node &config) {
+    spdlog::info("加载国标客户端配置信息");
+    if (config["rsms"]) {
+        if (config["rsms"]["reissue-store"]) {
+            reissue_store_type_ = config["rsms"]["reissue-store"].as<std::string>();
+            if (reissue_store_type_ != "ring" && reissue_store_type_ != "wal") {
+                spdlog::error("不支持的补发数据存储方式[{}]", reissue_store_type_);
+                return false;
+            }
+        }
+        if (config["rsms"]["reissue-store-path"]) {
+            reissue_store_path_ = config["rsms"]["reissue-store-path"].as<std::string>();
+        }
+        if (config["rsms"]["reissue-store-mb"]) {
+            reissue_store_mb_ = config["rsms"]["reissue-store-mb"].as<int>();
+            if (reissue_store_mb_ <= 0) {
+                spdlog::error("补发数据存储大小[{}]MB无效", reissue_store_mb_);
+                return false;
+            }
+        }
+        if (config["rsms"]["reissue-sync-interval-ms"]) {
+            reissue_sync_interval_ms_ = config["rsms"]["reissue-sync-interval-ms"].as<int>();
+        }
+        if (config["rsms"]["reissue-compress"]) {
+            is_reissue_compress_ = config["rsms"]["reissue-compress"].as<bool>();
+        }
+        if (config["rsms"]["reissue-keyframe-interval"]) {
+            reissue_keyframe_interval_ = config["rsms"]["reissue-keyframe-interval"].as<int>();
+            if (reissue_keyframe_interval_ <= 0) {
+                spdlog::error("补发数据关键帧间隔[{}]无效", reissue_keyframe_interval_);
+                return false;
+            }
+        }
+        if (config["rsms"]["reissue-index-interval-second"]) {
+            reissue_index_interval_second_ = config["rsms"]["reissue-index-interval-second"].as<int>();
+        }
+        if (config["rsms"]["reissue-retention-hour"]) {
+            reissue_retention_hour_ = config["rsms"]["reissue-retention-hour"].as<int>();
+        }
+        if (config["rsms"]["reissue-rate-floor"]) {
+            reissue_rate_floor_ = config["rsms"]["reissue-rate-floor"].as<int>();
+        }
+        if (config["rsms"]["reissue-rate-ceiling"]) {
+            reissue_rate_ceiling_ = config["rsms"]["reissue-rate-ceiling"].as<int>();
+        }
+        if (config["rsms"]["reissue-rate-step"]) {
+            reissue_rate_step_ = config["rsms"]["reissue-rate-step"].as<int>();
+        }
+        if (config["rsms"]["reissue-target-latency-ms"]) {
+            reissue_target_latency_ms_ = config["rsms"]["reissue-target-latency-ms"].as<int>();
+        }
+        if (config["rsms"]["reissue-max-inflight"]) {
+            reissue_max_inflight_ = config["rsms"]["reissue-max-inflight"].as<int>();
+        }
+        if (config["rsms"]["reissue-ack-timeout-ms"]) {
+            reissue_ack_timeout_ms_ = config["rsms"]["reissue-ack-timeout-ms"].as<int>();
+        }
+        if (config["rsms"]["reissue-batch-size"]) {
+            reissue_batch_size_ = config["rsms"]["reissue-batch-size"].as<int>();
+            if (reissue_batch_size_ <= 0 || reissue_batch_size_ > 65535) {
+                spdlog::error("补发信封报文数量[{}]无效", reissue_batch_size_);
+                return false;
+            }
+        }
+        if (config["rsms"]["reissue-batch-compress"]) {
+            std::string compression = config["rsms"]["reissue-batch-compress"].as<std::string>();
+            if (compression == "lz4") {
+                reissue_batch_compression_ = ENVELOPE_COMPRESSION_LZ4;
+            } else if (compression == "none") {
+                reissue_batch_compression_ = ENVELOPE_COMPRESSION_NONE;
+            } else {
+                spdlog::error("不支持的补发信封压缩方式[{}]", compression);
+                return false;
+            }
+        }
+        if (config["rsms"]["reissue-batch-topic"]) {
+            reissue_batch_topic_ = config["rsms"]["reissue-batch-topic"].as<std::string>();
+        }
+        if (reissue_rate_floor_ <= 0 || reissue_rate_ceiling_ < reissue_rate_floor_ || reissue_max_inflight_ <= 0 ||
+            reissue_ack_timeout_ms_ <= 0) {
+            spdlog::error("补发速率[{}-{}]在途上限[{}]确认超时[{}]无效", reissue_rate_floor_, reissue_rate_ceiling_,
+                          reissue_max_inflight_, reissue_ack_timeout_ms_);
+            return false;
+        }
+    }
+    return true;
+}
+
 void RsmsClient::load_config() {
     std::ifstream file(config_file_path_, std::ios::binary);
     if (!file.is_open()) {
@@ -54,12 +154,36 @@ void RsmsClient::load_config() {
 }
 
 void RsmsClient::load_data() {
+    if (!reissue_store_) {
+        std::string index_path;
+        if (reissue_store_type_ == "wal") {
+            std::string dir_path = reissue_store_path_.empty() ? "/tmp/rsms_reissue" : reissue_store_path_;
+            index_path = dir_path + "/index";
+            reissue_store_.reset(new RsmsReissueWal(dir_path, static_cast<size_t>(reissue_store_mb_) * 1024 * 1024,
+                                                    reissue_sync_interval_ms_));
+        } else {
+            std::string file_path = reissue_store_path_.empty() ? "/tmp/rsms_reissue.ring" : reissue_store_path_;
+            index_path = file_path + ".idx";
+            reissue_store_.reset(new RsmsReissueRing(file_path, static_cast<size_t>(reissue_store_mb_) * 1024 * 1024,
+                                                     reissue_sync_interval_ms_));
+        }
+        if (is_reissue_compress_) {
+            reissue_store_.reset(new RsmsReissueCodec(std::move(reissue_store_),
+                                                      static_cast<size_t>(reissue_keyframe_interval_)));
+        }
+        reissue_index_ = new RsmsReissueIndex(std::move(reissue_store_), index_path, reissue_index_interval_second_);
+        reissue_store_.reset(reissue_index_);
+    }
+    if (!reissue_store_->open()) {
+        spdlog::error("补发数据存储打开失败");
+        return;
+    }
     std::ifstream file(data_file_path_, std::ios::binary);
     if (!file.is_open()) {
-        spdlog::info("数据文件不存在");
+        spdlog::info("补发数据加载完成，数量[{}]", reissue_store_->size());
         return;
     }
-    reissue_messages_.clear();
+    size_t import_count = 0;
     while (file.peek() != EOF) {
         // 读取消息长度
         uint32_t length;
@@ -76,10 +200,65 @@ void RsmsClient::load_data() {
         if (file.gcount() != static_cast<std::streamsize>(length)) {
             break;
         }
-        reissue_messages_.push_back(std::move(message));
+        reissue_store_->append(message.data(), message.size());
+        import_count++;
     }
     file.close();
-    spdlog::info("配置文件加载完成");
+    if (reissue_store_->sync()) {
+        std::remove(data_file_path_.c_str());
+    }
+    spdlog::info("补发数据加载完成，数量[{}]，其中导入旧数据文件[{}]", reissue_store_->size(), import_count);
+}
+
+void RsmsClient::enqueue_reissue(std::vector<uint8_t> &&data_unit) {
+    reissue_queue_.push(std::move(data_unit));
+}
+
+void RsmsClient::enqueue_reissue(const uint8_t *data, size_t length) {
+    reissue_queue_.push(std::vector<uint8_t>(data, data + length));
+}
+
+size_t RsmsClient::flush_reissue_queue() {
+    reissue_batch_.clear();
+    size_t count = reissue_queue_.pop_all(reissue_batch_);
+    for (const auto &data_unit: reissue_batch_) {
+        if (!reissue_store_ || !reissue_store_->append(data_unit.data(), data_unit.size())) {
+            spdlog::warn("补发数据写入补发数据存储失败");
+        }
+    }
+    reissue_batch_.clear();
+    return count;
+}
+
+void RsmsClient::spill_reserve(uint64_t sequence) {
+    auto it = reserve_pending_.find(sequence);
+    if (it == reserve_pending_.end()) {
+        return;
+    }
+    const uint8_t *data = nullptr;
+    size_t length = 0;
+    if (!it->second.data.empty()) {
+        enqueue_reissue(std::move(it->second.data));
+    } else if (reserve_frames_.get(sequence, data, length)) {
+        enqueue_reissue(data, length);
+    }
+    reserve_pending_.erase(it);
+}
+
+void RsmsClient::evict_reserve(uint64_t sequence) {
+    auto it = reserve_pending_.find(sequence);
+    if (it == reserve_pending_.end()) {
+        return;
+    }
+    if (!it->second.is_sent && RsmsUplinkScheduler::get_instance().withdraw(it->second.type, sequence)) {
+        spill_reserve(sequence);
+        return;
+    }
+    const uint8_t *data = nullptr;
+    size_t length = 0;
+    if (reserve_frames_.get(sequence, data, length)) {
+        it->second.data.assign(data, data + length);
+    }
 }
 
 void RsmsClient::save_config() {
@@ -99,37 +278,20 @@ void RsmsClient::save_config() {
     spdlog::info("配置文件保存完成");
 }
 
-void RsmsClient::save_data() {
-    std::string temp_file = data_file_path_ + ".tmp";
-    std::ofstream file(temp_file, std::ios::binary);
-    if (!file.is_open()) {
-        spdlog::error("无法创建数据文件: {}", temp_file);
-        return;
-    }
-    for (const auto &message: reissue_messages_) {
-        uint32_t length = static_cast<uint32_t>(message.size());
-        file.write(reinterpret_cast<const char *>(&length), sizeof(length));
-        file.write(reinterpret_cast<const char *>(message.data()), message.size());
-    }
-    file.close();
-
-    if (hwyz::Utils::rename_file(temp_file, data_file_path_) != 0) {
-        spdlog::error("重命名数据文件失败");
-        std::remove(temp_file.c_str());
-    }
-    spdlog::info("数据文件保存完成");
-}
-
 bool RsmsClient::start() {
     spdlog::info("启动国标客户端实例");
     while (!is_init_) {
         is_init_ = init();
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
+    load_data();
     if (is_tsp_login_) {
         login();
     }
+    reissue_rate_.reset(new RsmsRateController(reissue_rate_floor_, reissue_rate_ceiling_, reissue_rate_step_,
+                                               reissue_target_latency_ms_));
     is_start_ = true;
+    RsmsUplinkScheduler::get_instance().set_listener(this);
     collect_thread_ = std::thread(&RsmsClient::collect_thread, this);
     reissue_thread_ = std::thread(&RsmsClient::reissue_thread, this);
     return true;
@@ -149,33 +311,196 @@ void RsmsClient::stop() {
     logout();
     is_start_ = false;
     is_vehicle_login_ = false;
+    cv_reissue_.notify_all();
+    if (collect_thread_.joinable()) {
+        collect_thread_.join();
+    }
+    if (reissue_thread_.joinable()) {
+        reissue_thread_.join();
+    }
+    RsmsUplinkScheduler::get_instance().set_listener(nullptr);
+    uint64_t retire_sequence;
+    {
+        // 不再接收发送结果，尚未确认的报警与实时数据转为补发，重启后补发（已送达的会重复上报）
+        std::lock_guard<std::mutex> lock(inflight_mutex_);
+        while (!reserve_pending_.empty()) {
+            spill_reserve(reserve_pending_.begin()->first);
+        }
+        retire_sequence = reissue_retire_sequence_;
+    }
+    // 补发线程已退出，由当前线程写入队列中剩余的补发数据并消费已确认的数据
+    flush_reissue_queue();
+    if (reissue_store_) {
+        reissue_store_->consume(retire_sequence);
+        reissue_store_->close();
+    }
+}
+
+bool RsmsClient::request_time_range(long long start_time, long long end_time) {
+    if (reissue_index_ == nullptr || start_time > end_time) {
+        spdlog::warn("按时间范围[{}-{}]补发请求无效", start_time, end_time);
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(inflight_mutex_);
+    // 按时间索引定位需要读取存储，由补发线程执行
+    reissue_ranges_.push_back({start_time, end_time, false, 0, 0, 0});
+    cv_reissue_.notify_all();
+    return true;
+}
+
+void RsmsClient::on_uplink_sent(uplink_class_t type, uint64_t tag, bool is_success) {
+    std::lock_guard<std::mutex> lock(inflight_mutex_);
+    if (type == UPLINK_CLASS_REISSUE && (tag & kRangeReissueTag) != 0) {
+        auto it = range_inflight_.find(tag & ~kRangeReissueTag);
+        if (it == range_inflight_.end() || it->second.state != REISSUE_QUEUED) {
+            return;
+        }
+        if (is_success) {
+            it->second.sent_time = std::chrono::steady_clock::now();
+            it->second.state = REISSUE_SENT;
+        } else {
+            it->second.state = REISSUE_PENDING;
+            cv_reissue_.notify_all();
+        }
+    } else if (type == UPLINK_CLASS_REISSUE) {
+        reissue_inflight_t *entry = find_inflight(tag);
+        if (entry == nullptr || entry->state != REISSUE_QUEUED || entry->batch_count == 0) {
+            return;
+        }
+        if (is_success) {
+            entry->sent_time = std::chrono::steady_clock::now();
+            set_batch_state(*entry, REISSUE_SENT);
+        } else {
+            set_batch_state(*entry, REISSUE_PENDING);
+            cv_reissue_.notify_all();
+        }
+    } else if (type == UPLINK_CLASS_ALARM || type == UPLINK_CLASS_REALTIME) {
+        auto it = reserve_pending_.find(tag);
+        if (it == reserve_pending_.end()) {
+            return;
+        }
+        if (is_success) {
+            it->second.is_sent = true;
+        } else {
+            spdlog::warn("{}数据[{}]发送失败，转为补发", type == UPLINK_CLASS_ALARM ? "报警" : "实时", tag);
+            spill_reserve(tag);
+        }
+    }
+}
+
+void RsmsClient::on_uplink_ack(uplink_class_t type, uint64_t tag, std::chrono::steady_clock::duration latency) {
+    std::lock_guard<std::mutex> lock(inflight_mutex_);
+    if (type == UPLINK_CLASS_REISSUE && (tag & kRangeReissueTag) != 0) {
+        if (range_inflight_.erase(tag & ~kRangeReissueTag) > 0) {
+            reissue_rate_->on_ack(latency);
+            cv_reissue_.notify_all();
+        }
+        return;
+    }
+    if (type == UPLINK_CLASS_REISSUE) {
+        reissue_inflight_t *entry = find_inflight(tag);
+        if (entry == nullptr || entry->state == REISSUE_ACKED || entry->batch_count == 0) {
+            return;
+        }
+        set_batch_state(*entry, REISSUE_ACKED);
+        reissue_rate_->on_ack(latency);
+        retire_acked();
+        cv_reissue_.notify_all();
+        return;
+    }
+    // 实时数据确认时延用于补发速率控制
+    if (type == UPLINK_CLASS_REALTIME || type == UPLINK_CLASS_ALARM) {
+        reserve_pending_.erase(tag);
+        reissue_rate_->on_realtime_ack(latency);
+    }
+}
+
+void RsmsClient::on_uplink_lost() {
+    std::lock_guard<std::mutex> lock(inflight_mutex_);
+    size_t count = 0;
+    for (auto &entry: reissue_inflight_) {
+        if (entry.state == REISSUE_SENT) {
+            entry.state = REISSUE_PENDING;
+            count++;
+        }
+    }
+    for (auto &range_entry: range_inflight_) {
+        if (range_entry.second.state == REISSUE_SENT) {
+            range_entry.second.state = REISSUE_PENDING;
+            count++;
+        }
+    }
+    if (count > 0) {
+        spdlog::info("连接断开，未确认的补发数据[{}]条待重连后重新发送", count);
+    }
+    // 已发送未确认的报警与实时数据可能丢失，转为补发
+    std::vector<uint64_t> sent_sequences;
+    for (const auto &pending: reserve_pending_) {
+        if (pending.second.is_sent) {
+            sent_sequences.push_back(pending.first);
+        }
+    }
+    for (uint64_t sequence: sent_sequences) {
+        spill_reserve(sequence);
+    }
+    if (reissue_rate_) {
+        reissue_rate_->on_congestion();
+    }
 }
 
 bool RsmsClient::login() {
     spdlog::info("车辆登录");
     std::vector<uint8_t> vehicle_login = build_vehicle_login();
-    std::vector<uint8_t> message = build_message(VEHICLE_LOGIN, vehicle_login);
-    int mid = 0;
-    MqttClient::get_instance().publish(mid, mqtt_topic_, &message, 1);
+    bool is_submitted = RsmsUplinkScheduler::get_instance().submit(UPLINK_CLASS_CONTROL, mqtt_topic_,
+                                                                   build_message(VEHICLE_LOGIN, vehicle_login));
     is_vehicle_login_ = true;
     save_config();
+    return is_submitted;
 }
 
 bool RsmsClient::collect_signal() {
     spdlog::debug("采集信号数据");
     std::vector<uint8_t> realtime_signal = build_realtime_signal();
-    if (reserve_messages_.size() >= max_reserve_messages_) {
-        reserve_messages_.pop_front();
+    uint64_t sequence = 0;
+    {
+        std::lock_guard<std::mutex> lock(inflight_mutex_);
+        // 即将被覆盖的报警或实时数据仍未确认时撤回转为补发，无法撤回时保留副本
+        if (reserve_frames_.is_full()) {
+            evict_reserve(reserve_frames_.front_sequence());
+        }
+        sequence = reserve_frames_.push(realtime_signal.data(), realtime_signal.size());
     }
-    reserve_messages_.push_back(realtime_signal);
     long long now = hwyz::Utils::get_current_timestamp_sec();
     if (is_alarm3()) {
         if (last_alarm_timestamp_ == 0) {
             spdlog::warn("发生三级报警[{}]", now);
             last_alarm_timestamp_ = now;
-            for (const auto &reserved_message: reserve_messages_) {
-                reissue_messages_.push_back(reserved_message);
+            // 报警前的数据以补发方式优先上报，登录前直接进入补发存储
+            // 预留数据帧直接从缓冲中构造报文，确认前由帧序号引用，发送失败或即将被覆盖时才转为补发
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            bool is_login = is_tsp_login_ && is_vehicle_login_;
+            std::vector<std::vector<uint8_t>> data_units;
+            // 采集间隔随即调整为1秒，当前数据帧到期时由下方按实时数据发送或转为补发，不重复上报
+            uint64_t end_sequence = now - last_collect_timestamp_ >= 1 ? sequence : sequence + 1;
+            for (uint64_t alarm_sequence = reserve_frames_.front_sequence();
+                 alarm_sequence < end_sequence; alarm_sequence++) {
+                const uint8_t *data = nullptr;
+                size_t length = 0;
+                if (reserve_pending_.count(alarm_sequence) > 0 || !reserve_frames_.get(alarm_sequence, data, length)) {
+                    continue;
+                }
+                if (!is_login) {
+                    data_units.emplace_back(data, data + length);
+                    continue;
+                }
+                reserve_pending_[alarm_sequence] = reserve_pending_t{UPLINK_CLASS_ALARM, false, {}};
+                if (!RsmsUplinkScheduler::get_instance().submit(UPLINK_CLASS_ALARM, mqtt_topic_,
+                                                                build_message(REISSUE_REPORT, data, length),
+                                                                alarm_sequence)) {
+                    spill_reserve(alarm_sequence);
+                }
             }
+            reissue_queue_.push_batch(std::move(data_units));
         }
         if (now - last_alarm_timestamp_ <= 30) {
             spdlog::warn("采集间隔调整为1秒[{}]", now);
@@ -188,11 +513,20 @@ bool RsmsClient::collect_signal() {
     if (now - last_collect_timestamp_ >= collect_interval_) {
         last_collect_timestamp_ = now;
         if (is_tsp_login_ && is_vehicle_login_) {
-            int mid = 0;
-            std::vector<uint8_t> message = build_message(REALTIME_REPORT, realtime_signal);
-            return MqttClient::get_instance().publish(mid, mqtt_topic_, &message, 1);
+            // 报警期间的实时数据与报警数据同等优先
+            uplink_class_t type = last_alarm_timestamp_ > 0 ? UPLINK_CLASS_ALARM : UPLINK_CLASS_REALTIME;
+            // 确认前由预留数据帧序号引用，未被接受（队列已满、未连接、发送失败或确认前断开）时转为补发
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            reserve_pending_[sequence] = reserve_pending_t{type, false, {}};
+            if (!RsmsUplinkScheduler::get_instance().submit(type, mqtt_topic_,
+                                                            build_message(REALTIME_REPORT, realtime_signal),
+                                                            sequence)) {
+                spdlog::warn("实时数据[{}]提交失败，转为补发", sequence);
+                spill_reserve(sequence);
+            }
+            return true;
         }
-        reissue_messages_.push_back(realtime_signal);
+        enqueue_reissue(std::move(realtime_signal));
     }
     return true;
 }
@@ -200,9 +534,8 @@ bool RsmsClient::collect_signal() {
 void RsmsClient::logout() {
     spdlog::info("车辆登出");
     std::vector<uint8_t> vehicle_logout = build_vehicle_logout();
-    std::vector<uint8_t> message = build_message(VEHICLE_LOGOUT, vehicle_logout);
-    int mid = 0;
-    MqttClient::get_instance().publish(mid, mqtt_topic_, &message, 1);
+    RsmsUplinkScheduler::get_instance().submit(UPLINK_CLASS_CONTROL, mqtt_topic_,
+                                               build_message(VEHICLE_LOGOUT, vehicle_logout));
 }
 
 std::vector<uint8_t> RsmsClient::get_current_time() {
@@ -817,19 +1150,20 @@ std::vector<uint8_t> RsmsClient::build_vehicle_logout() {
     return vehicle_logout_bytes;
 }
 
-uint8_t RsmsClient::calculate_check_code(std::vector<uint8_t> data_unit) {
-    if (data_unit.empty()) {
-        return 0;
-    }
+uint8_t RsmsClient::calculate_check_code(const uint8_t *data, size_t length) {
     uint8_t check_code = 0;
-    for (uint8_t byte_val: data_unit) {
-        check_code ^= byte_val;
+    for (size_t i = 0; i < length; i++) {
+        check_code ^= data[i];
     }
     return check_code;
 }
 
 std::vector<uint8_t> RsmsClient::build_message(command_flag_t command_flag, const std::vector<uint8_t> &data_unit) {
-    int total_length = 24 + data_unit.size() + 1;
+    return build_message(command_flag, data_unit.data(), data_unit.size());
+}
+
+std::vector<uint8_t> RsmsClient::build_message(command_flag_t command_flag, const uint8_t *data_unit, size_t length) {
+    int total_length = 24 + length + 1;
     std::vector<uint8_t> message_bytes(total_length);
     std::vector<uint8_t> starting_symbols_bytes = string_to_bytes(starting_symbols_);
     std::copy(starting_symbols_bytes.begin(), starting_symbols_bytes.end(), message_bytes.begin());
@@ -838,13 +1172,10 @@ std::vector<uint8_t> RsmsClient::build_message(command_flag_t command_flag, cons
     std::vector<uint8_t> vin_bytes = string_to_bytes(vin_);
     std::copy(vin_bytes.begin(), vin_bytes.end(), message_bytes.begin() + 4);
     message_bytes[21] = NONE;
-    std::vector<uint8_t> data_unit_length = word_to_bytes(data_unit.size());
+    std::vector<uint8_t> data_unit_length = word_to_bytes(length);
     std::copy(data_unit_length.begin(), data_unit_length.end(), message_bytes.begin() + 22);
-    std::copy(data_unit.begin(), data_unit.end(), message_bytes.begin() + 24);
-    int check_length = 22 + data_unit.size();
-    std::vector<uint8_t> check_bytes(check_length);
-    std::copy(message_bytes.begin() + 2, message_bytes.end() - 1, check_bytes.begin());
-    message_bytes[total_length - 1] = calculate_check_code(check_bytes);
+    std::copy(data_unit, data_unit + length, message_bytes.begin() + 24);
+    message_bytes[total_length - 1] = calculate_check_code(message_bytes.data() + 2, 22 + length);
     return message_bytes;
 }
 
@@ -877,32 +1208,322 @@ void RsmsClient::collect_thread() {
     }
 }
 
-void RsmsClient::reissue_thread() {
-    spdlog::info("初始化补发线程");
-    while (is_start_) {
-        if (is_tsp_login_ && is_vehicle_login_) {
-            std::vector<std::vector<uint8_t>> messages_to_send;
-            {
-                std::unique_lock<std::mutex> lock(reissue_mutex_);
-                int count = 0;
-                while (!reissue_messages_.empty() && count < reissue_count_per_second_) {
-                    messages_to_send.push_back(reissue_messages_.front());
-                    reissue_messages_.pop_front();
-                    count++;
-                }
+bool RsmsClient::submit_reissue(const std::vector<std::vector<uint8_t>> &data_units, size_t offset, size_t count,
+                                uint64_t tag) {
+    RsmsUplinkScheduler &scheduler = RsmsUplinkScheduler::get_instance();
+    if (count == 1) {
+        return scheduler.submit(UPLINK_CLASS_REISSUE, mqtt_topic_, build_message(REISSUE_REPORT, data_units[offset]),
+                                tag);
+    }
+    reissue_envelope_frames_.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        reissue_envelope_frames_[i] = build_message(REISSUE_REPORT, data_units[offset + i]);
+    }
+    std::vector<uint8_t> envelope;
+    pack_reissue_envelope(reissue_envelope_frames_, reissue_batch_compression_, envelope);
+    return scheduler.submit(UPLINK_CLASS_REISSUE, reissue_batch_topic_, std::move(envelope), tag);
+}
+
+void RsmsClient::plan_reissue(std::chrono::steady_clock::time_point now, reissue_plan_t &plan) {
+    size_t max_inflight = static_cast<size_t>(reissue_max_inflight_);
+    reissue_rate_->update(now, reissue_inflight_.size() + range_inflight_.size() >= max_inflight);
+    // 存储空间不足时最早的数据可能已被淘汰，已确认尚未消费的数据不再发送
+    uint64_t head_sequence = std::max(reissue_store_->head_sequence(), reissue_retire_sequence_);
+    while (!reissue_inflight_.empty() && reissue_inflight_.front().sequence < head_sequence) {
+        reissue_inflight_.pop_front();
+    }
+    range_inflight_.erase(range_inflight_.begin(), range_inflight_.lower_bound(head_sequence));
+    // 首条被淘汰的同批数据各自单独重新发送
+    if (!reissue_inflight_.empty() && reissue_inflight_.front().batch_count == 0) {
+        for (size_t i = 0; i < reissue_inflight_.size() && reissue_inflight_[i].batch_count == 0; i++) {
+            reissue_inflight_[i].batch_count = 1;
+        }
+    }
+    // 确认超时或连接断开未确认的需要重新发送，同一次发布的数据状态相同，按原批次重新发送
+    auto ack_timeout = std::chrono::milliseconds(reissue_ack_timeout_ms_);
+    std::vector<reissue_inflight_t *> candidates;
+    bool is_timeout = false;
+    for (size_t index = 0; index < reissue_inflight_.size();) {
+        reissue_inflight_t &entry = reissue_inflight_[index];
+        index += std::max<size_t>(1, std::min(entry.batch_count, reissue_inflight_.size() - index));
+        bool is_expired = entry.state == REISSUE_SENT && now - entry.sent_time >= ack_timeout;
+        if (entry.batch_count > 0 && (entry.state == REISSUE_PENDING || is_expired)) {
+            candidates.push_back(&entry);
+            is_timeout = is_timeout || is_expired;
+        }
+    }
+    size_t backlog_candidates = candidates.size();
+    for (auto &range_entry: range_inflight_) {
+        reissue_inflight_t &entry = range_entry.second;
+        bool is_expired = entry.state == REISSUE_SENT && now - entry.sent_time >= ack_timeout;
+        if (entry.state == REISSUE_PENDING || is_expired) {
+            candidates.push_back(&entry);
+            is_timeout = is_timeout || is_expired;
+        }
+    }
+    if (is_timeout) {
+        reissue_rate_->on_congestion();
+    }
+    size_t batch_size = static_cast<size_t>(reissue_batch_size_);
+    size_t window = reissue_inflight_.size() + range_inflight_.size();
+    size_t room = window < max_inflight ? max_inflight - window : 0;
+    // 有按采集时间范围补发的请求时先补发请求的数据，每条单独发布
+    bool is_range = !reissue_ranges_.empty();
+    size_t new_publishes = is_range ? room : (room + batch_size - 1) / batch_size;
+    size_t tokens = reissue_rate_->acquire(now, candidates.size() + new_publishes);
+    for (size_t i = 0; i < candidates.size() && tokens > 0; i++) {
+        reissue_inflight_t &entry = *candidates[i];
+        bool is_range_entry = i >= backlog_candidates;
+        size_t count = 1;
+        if (!is_range_entry) {
+            size_t index = static_cast<size_t>(entry.sequence - reissue_inflight_.front().sequence);
+            count = std::min(entry.batch_count, reissue_inflight_.size() - index);
+        }
+        if (entry.state == REISSUE_SENT) {
+            reissue_timeout_count_++;
+            spdlog::warn("补发数据[{}]等[{}]条确认超时，重新发送，累计超时[{}]", entry.sequence, count,
+                         reissue_timeout_count_);
+        }
+        // 提交前标记为已提交，锁外提交期间到达的发送结果不会被忽略
+        if (is_range_entry) {
+            entry.state = REISSUE_QUEUED;
+        } else {
+            set_batch_state(entry, REISSUE_QUEUED);
+        }
+        plan.resend_tasks.push_back({entry.sequence, count, is_range_entry});
+        tokens--;
+    }
+    if (tokens == 0 || room == 0) {
+        return;
+    }
+    if (is_range) {
+        plan.range_count = std::min(tokens, room);
+    } else {
+        plan.next_sequence = reissue_inflight_.empty() ? head_sequence : reissue_inflight_.back().sequence + 1;
+        plan.new_count = std::min(tokens * batch_size, room);
+        plan.new_batches = tokens;
+    }
+}
+
+void RsmsClient::resend_reissue(const std::vector<reissue_task_t> &tasks) {
+    std::vector<std::vector<uint8_t>> frames;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        const reissue_task_t &task = tasks[i];
+        frames.clear();
+        uint64_t sequence = 0;
+        if (reissue_store_->peek(task.sequence, task.count, frames, sequence) != task.count ||
+            sequence != task.sequence) {
+            // 已被淘汰的数据由下次生成补发计划时移除
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            restore_pending(task);
+            continue;
+        }
+        if (!submit_reissue(frames, 0, task.count, task.is_range ? kRangeReissueTag | task.sequence : task.sequence)) {
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            for (size_t j = i; j < tasks.size(); j++) {
+                restore_pending(tasks[j]);
             }
-            if (!messages_to_send.empty()) {
-                spdlog::info("开始补发数据[{}]，数量[{}]",
-                             hwyz::Utils::get_current_timestamp_sec(), messages_to_send.size());
-                for (const auto &realtime_signal: messages_to_send) {
-                    int mid = 0;
-                    std::vector<uint8_t> message = build_message(REISSUE_REPORT, realtime_signal);
-                    MqttClient::get_instance().publish(mid, mqtt_topic_, &message, 1);
-                }
+            return;
+        }
+    }
+}
+
+void RsmsClient::send_range_reissue(size_t max_count) {
+    reissue_range_t range{};
+    {
+        std::lock_guard<std::mutex> lock(inflight_mutex_);
+        if (reissue_ranges_.empty()) {
+            return;
+        }
+        range = reissue_ranges_.front();
+    }
+    if (!range.is_located) {
+        range.next_sequence = reissue_index_->seek(range.start_time);
+        range.end_sequence = reissue_index_->seek_end(range.end_time);
+        range.is_located = true;
+    }
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<std::vector<uint8_t>> data_units;
+    std::vector<uint64_t> sequences;
+    while (range.next_sequence < range.end_sequence && data_units.size() < max_count) {
+        frames.clear();
+        uint64_t first_sequence = 0;
+        size_t read_count = reissue_store_->peek(range.next_sequence, static_cast<size_t>(std::min<uint64_t>(
+                range.end_sequence - range.next_sequence, kRangeReadCount)), frames, first_sequence);
+        if (read_count == 0) {
+            range.next_sequence = range.end_sequence;
+            break;
+        }
+        size_t i = 0;
+        for (; i < read_count && data_units.size() < max_count; i++) {
+            // 索引只定位到索引间隔，逐条按采集时间过滤
+            long long timestamp = RsmsReissueIndex::get_frame_time(frames[i].data(), frames[i].size());
+            if (timestamp >= range.start_time && timestamp <= range.end_time) {
+                sequences.push_back(first_sequence + i);
+                data_units.push_back(std::move(frames[i]));
             }
         }
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        range.next_sequence = first_sequence + i;
+    }
+    {
+        std::lock_guard<std::mutex> lock(inflight_mutex_);
+        auto now = std::chrono::steady_clock::now();
+        for (uint64_t sequence: sequences) {
+            range_inflight_[sequence] = {sequence, REISSUE_QUEUED, now, 1};
+        }
+        range.count += sequences.size();
+        if (range.next_sequence < range.end_sequence) {
+            reissue_ranges_.front() = range;
+        } else {
+            reissue_ranges_.pop_front();
+            spdlog::info("按时间范围[{}-{}]补发数据[{}]条", range.start_time, range.end_time, range.count);
+        }
+    }
+    for (size_t i = 0; i < data_units.size(); i++) {
+        if (!submit_reissue(data_units, i, 1, kRangeReissueTag | sequences[i])) {
+            spdlog::warn("按时间范围[{}-{}]补发时补发队列已满，剩余[{}]条稍后重新发送", range.start_time,
+                         range.end_time, data_units.size() - i);
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            for (size_t j = i; j < data_units.size(); j++) {
+                restore_pending({sequences[j], 1, true});
+            }
+            return;
+        }
     }
 }
 
+void RsmsClient::send_new_reissue(uint64_t next_sequence, size_t max_count, size_t max_batches) {
+    std::vector<std::vector<uint8_t>> frames;
+    uint64_t sequence = 0;
+    size_t count = reissue_store_->peek(next_sequence, max_count, frames, sequence);
+    if (count == 0) {
+        return;
+    }
+    size_t batch_size = static_cast<size_t>(reissue_batch_size_);
+    count = std::min(count, max_batches * batch_size);
+    std::vector<reissue_task_t> tasks;
+    size_t inflight_count;
+    {
+        std::lock_guard<std::mutex> lock(inflight_mutex_);
+        // 生成补发计划后存储可能在后台淘汰了更早的数据，在途补发数据必须序号连续，移除已被淘汰的在途数据
+        if (sequence != next_sequence) {
+            while (!reissue_inflight_.empty() && reissue_inflight_.front().sequence < sequence) {
+                reissue_inflight_.pop_front();
+            }
+        }
+        auto now = std::chrono::steady_clock::now();
+        for (size_t offset = 0; offset < count; offset += batch_size) {
+            size_t batch_count = std::min(batch_size, count - offset);
+            reissue_inflight_.push_back({sequence + offset, REISSUE_QUEUED, now, batch_count});
+            for (size_t i = 1; i < batch_count; i++) {
+                reissue_inflight_.push_back({sequence + offset + i, REISSUE_QUEUED, now, 0});
+            }
+            tasks.push_back({sequence + offset, batch_count, false});
+        }
+        inflight_count = reissue_inflight_.size();
+    }
+    size_t sent_count = 0;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        if (!submit_reissue(frames, static_cast<size_t>(tasks[i].sequence - sequence), tasks[i].count,
+                            tasks[i].sequence)) {
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            for (size_t j = i; j < tasks.size(); j++) {
+                restore_pending(tasks[j]);
+            }
+            break;
+        }
+        sent_count += tasks[i].count;
+    }
+    if (sent_count > 0) {
+        spdlog::debug("补发数据[{}]条，在途[{}]条，补发速率[{:.1f}]", sent_count, inflight_count,
+                      reissue_rate_->get_rate());
+    }
+}
 
+void RsmsClient::restore_pending(const reissue_task_t &task) {
+    if (task.is_range) {
+        auto it = range_inflight_.find(task.sequence);
+        if (it != range_inflight_.end() && it->second.state == REISSUE_QUEUED) {
+            it->second.state = REISSUE_PENDING;
+        }
+        return;
+    }
+    reissue_inflight_t *entry = find_inflight(task.sequence);
+    if (entry != nullptr && entry->state == REISSUE_QUEUED && entry->batch_count > 0) {
+        set_batch_state(*entry, REISSUE_PENDING);
+    }
+}
+
+void RsmsClient::set_batch_state(reissue_inflight_t &entry, reissue_state_t state) {
+    // 同一次发布的在途补发数据序号连续且位于首条之后
+    size_t index = entry.sequence - reissue_inflight_.front().sequence;
+    size_t end = std::min(index + entry.batch_count, reissue_inflight_.size());
+    for (size_t i = index; i < end; i++) {
+        reissue_inflight_[i].state = state;
+        reissue_inflight_[i].sent_time = entry.sent_time;
+    }
+}
+
+RsmsClient::reissue_inflight_t *RsmsClient::find_inflight(uint64_t sequence) {
+    if (reissue_inflight_.empty() || sequence < reissue_inflight_.front().sequence) {
+        return nullptr;
+    }
+    // 在途补发数据序号连续
+    size_t index = sequence - reissue_inflight_.front().sequence;
+    if (index >= reissue_inflight_.size()) {
+        return nullptr;
+    }
+    return &reissue_inflight_[index];
+}
+
+void RsmsClient::retire_acked() {
+    uint64_t end_sequence = 0;
+    while (!reissue_inflight_.empty() && reissue_inflight_.front().state == REISSUE_ACKED) {
+        end_sequence = reissue_inflight_.front().sequence + 1;
+        reissue_inflight_.pop_front();
+    }
+    reissue_retire_sequence_ = std::max(reissue_retire_sequence_, end_sequence);
+}
+
+void RsmsClient::reissue_thread() {
+    spdlog::info("初始化补发线程");
+    long long last_trim_timestamp = 0;
+    uint64_t consumed_sequence = 0;
+    while (is_start_) {
+        // 补发线程是补发数据队列唯一的消费者，写入存储不占用在途补发数据锁
+        flush_reissue_queue();
+        // 存储消费可能等待落盘，不占用在途补发数据锁
+        uint64_t retire_sequence;
+        {
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            retire_sequence = reissue_retire_sequence_;
+        }
+        if (retire_sequence > consumed_sequence && reissue_store_) {
+            reissue_store_->consume(retire_sequence);
+            consumed_sequence = retire_sequence;
+        }
+        long long now_second = hwyz::Utils::get_current_timestamp_sec();
+        if (reissue_retention_hour_ > 0 && reissue_index_ != nullptr &&
+            now_second - last_trim_timestamp >= kRetentionTrimIntervalSecond) {
+            last_trim_timestamp = now_second;
+            reissue_index_->trim(now_second - reissue_retention_hour_ * 3600LL);
+        }
+        // 锁内只决定发送哪些数据，读取存储、编码压缩与提交在锁外执行，不阻塞网络线程的发送结果与确认回调
+        reissue_plan_t plan;
+        {
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            if (is_tsp_login_ && is_vehicle_login_ && reissue_store_ && MqttClient::get_uplink().is_connected()) {
+                plan_reissue(std::chrono::steady_clock::now(), plan);
+            }
+        }
+        resend_reissue(plan.resend_tasks);
+        if (plan.range_count > 0) {
+            send_range_reissue(plan.range_count);
+        }
+        if (plan.new_batches > 0) {
+            send_new_reissue(plan.next_sequence, plan.new_count, plan.new_batches);
+        }
+        std::unique_lock<std::mutex> lock(inflight_mutex_);
+        cv_reissue_.wait_for(lock, reissue_rate_->next_token_wait());
+    }
+}
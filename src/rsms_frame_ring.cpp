@@ -0,0 +1,62 @@
+//
+// Created by hwyz_leo on 2025/9/6.
+//
+#include <algorithm>
+#include <cstring>
+
+#include "spdlog/spdlog.h"
+
+#include "rsms_frame_ring.h"
+
+RsmsFrameRing::RsmsFrameRing(size_t slot_count)
+        : slot_count_(std::max<size_t>(slot_count, 1)), lengths_(slot_count_, 0) {
+}
+
+void RsmsFrameRing::reserve(size_t slot_bytes) {
+    if (slot_bytes <= slot_bytes_) {
+        return;
+    }
+    std::vector<uint8_t> arena(slot_count_ * slot_bytes);
+    for (size_t i = 0; i < slot_count_ && slot_bytes_ > 0; i++) {
+        std::memcpy(arena.data() + i * slot_bytes, arena_.data() + i * slot_bytes_, lengths_[i]);
+    }
+    arena_.swap(arena);
+    slot_bytes_ = slot_bytes;
+}
+
+uint64_t RsmsFrameRing::push(const uint8_t *data, size_t length) {
+    if (length > slot_bytes_) {
+        if (slot_bytes_ > 0) {
+            spdlog::info("数据帧长度[{}]超过槽位大小[{}]，重新分配", length, slot_bytes_);
+        }
+        reserve(length);
+    }
+    uint64_t sequence = next_sequence_++;
+    size_t slot = static_cast<size_t>(sequence % slot_count_);
+    std::memcpy(arena_.data() + slot * slot_bytes_, data, length);
+    lengths_[slot] = static_cast<uint32_t>(length);
+    count_ = std::min(count_ + 1, slot_count_);
+    return sequence;
+}
+
+bool RsmsFrameRing::get(uint64_t sequence, const uint8_t *&out_data, size_t &out_length) const {
+    if (sequence < front_sequence() || sequence >= next_sequence_) {
+        return false;
+    }
+    size_t slot = static_cast<size_t>(sequence % slot_count_);
+    out_data = arena_.data() + slot * slot_bytes_;
+    out_length = lengths_[slot];
+    return true;
+}
+
+uint64_t RsmsFrameRing::front_sequence() const {
+    return next_sequence_ - count_;
+}
+
+uint64_t RsmsFrameRing::end_sequence() const {
+    return next_sequence_;
+}
+
+bool RsmsFrameRing::is_full() const {
+    return count_ == slot_count_;
+}
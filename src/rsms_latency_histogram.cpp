@@ -0,0 +1,94 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+#include <algorithm>
+
+#include "rsms_latency_histogram.h"
+
+namespace {
+// 每个2的幂区间的子桶位数
+const int kSubBucketBits = 3;
+// 每个2的幂区间的子桶数量
+const uint64_t kSubBucketCount = 1ULL << kSubBucketBits;
+// 分桶总数，覆盖全部64位取值
+const size_t kBucketCount = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+int highest_bit(uint64_t value) {
+    int bit = 0;
+    while (value >>= 1) {
+        bit++;
+    }
+    return bit;
+}
+}
+
+RsmsLatencyHistogram::RsmsLatencyHistogram() : counts_(kBucketCount, 0) {
+}
+
+void RsmsLatencyHistogram::record(uint64_t value) {
+    counts_[bucket_index(value)]++;
+    min_ = count_ == 0 ? value : std::min(min_, value);
+    max_ = std::max(max_, value);
+    sum_ += static_cast<double>(value);
+    count_++;
+}
+
+uint64_t RsmsLatencyHistogram::percentile(double quantile) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    quantile = std::min(std::max(quantile, 0.0), 1.0);
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * static_cast<double>(count_) + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts_.size(); i++) {
+        seen += counts_[i];
+        if (seen >= rank) {
+            return std::min(bucket_upper(i), max_);
+        }
+    }
+    return max_;
+}
+
+uint64_t RsmsLatencyHistogram::count() const {
+    return count_;
+}
+
+uint64_t RsmsLatencyHistogram::min() const {
+    return min_;
+}
+
+uint64_t RsmsLatencyHistogram::max() const {
+    return max_;
+}
+
+double RsmsLatencyHistogram::mean() const {
+    return count_ == 0 ? 0 : sum_ / static_cast<double>(count_);
+}
+
+void RsmsLatencyHistogram::reset() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    count_ = 0;
+    min_ = 0;
+    max_ = 0;
+    sum_ = 0;
+}
+
+size_t RsmsLatencyHistogram::bucket_index(uint64_t value) {
+    if (value < kSubBucketCount) {
+        return static_cast<size_t>(value);
+    }
+    int magnitude = highest_bit(value);
+    int shift = magnitude - kSubBucketBits;
+    uint64_t sub_bucket = (value >> shift) - kSubBucketCount;
+    return static_cast<size_t>((shift + 1) * kSubBucketCount + sub_bucket);
+}
+
+uint64_t RsmsLatencyHistogram::bucket_upper(size_t index) {
+    if (index < kSubBucketCount) {
+        return index;
+    }
+    int shift = static_cast<int>(index / kSubBucketCount) - 1;
+    uint64_t sub_bucket = index % kSubBucketCount;
+    uint64_t lower = (kSubBucketCount + sub_bucket) << shift;
+    return lower + ((1ULL << shift) - 1);
+}
@@ -0,0 +1,79 @@
+//
+// Created by hwyz_leo on 2025/9/1.
+//
+#include <algorithm>
+
+#include "spdlog/spdlog.h"
+
+#include "rsms_rate_controller.h"
+
+namespace {
+// 控制周期
+const std::chrono::milliseconds kUpdateInterval(1000);
+// 乘性减小系数
+const double kDecreaseFactor = 0.5;
+// 确认时延平滑系数
+const double kLatencyAlpha = 0.2;
+// 令牌桶容量对应的发送时长（秒），避免积攒令牌后突发发送
+const double kBurstSeconds = 0.2;
+}
+
+RsmsRateController::RsmsRateController(double floor, double ceiling, double step, int target_latency_ms)
+        : floor_(floor), ceiling_(std::max(floor, ceiling)), step_(step), target_latency_ms_(target_latency_ms),
+          rate_(floor), last_refill_time_(clock_t::now()), last_update_time_(clock_t::now()) {}
+
+size_t RsmsRateController::acquire(clock_t::time_point now, size_t max_count) {
+    double elapsed = std::chrono::duration<double>(now - last_refill_time_).count();
+    last_refill_time_ = now;
+    tokens_ = std::min(tokens_ + rate_ * elapsed, std::max(1.0, rate_ * kBurstSeconds));
+    size_t count = std::min(max_count, static_cast<size_t>(tokens_));
+    tokens_ -= static_cast<double>(count);
+    return count;
+}
+
+void RsmsRateController::update(clock_t::time_point now, bool is_window_full) {
+    if (now - last_update_time_ < kUpdateInterval) {
+        return;
+    }
+    last_update_time_ = now;
+    double rate = rate_;
+    if (is_congested_ || (ack_count_ > 0 && latency_ms_ > target_latency_ms_) ||
+        realtime_latency_ms_ > target_latency_ms_) {
+        rate_ = std::max(floor_, rate_ * kDecreaseFactor);
+    } else if (ack_count_ > 0 && !is_window_full) {
+        // 在途窗口已满时速率不是瓶颈，不再增加
+        rate_ = std::min(ceiling_, rate_ + step_);
+    }
+    if (rate != rate_) {
+        spdlog::debug("补发速率调整为[{:.1f}]，确认时延[{:.0f}]毫秒，实时数据确认时延[{:.0f}]毫秒", rate_, latency_ms_,
+                      realtime_latency_ms_);
+    }
+    ack_count_ = 0;
+    realtime_latency_ms_ = 0;
+    is_congested_ = false;
+}
+
+void RsmsRateController::on_ack(clock_t::duration latency) {
+    double latency_ms = std::chrono::duration<double, std::milli>(latency).count();
+    latency_ms_ = ack_count_ == 0 && latency_ms_ == 0 ? latency_ms :
+                  latency_ms_ + kLatencyAlpha * (latency_ms - latency_ms_);
+    ack_count_++;
+}
+
+void RsmsRateController::on_realtime_ack(clock_t::duration latency) {
+    realtime_latency_ms_ = std::max(realtime_latency_ms_, std::chrono::duration<double, std::milli>(latency).count());
+}
+
+void RsmsRateController::on_congestion() {
+    is_congested_ = true;
+}
+
+double RsmsRateController::get_rate() const {
+    return rate_;
+}
+
+std::chrono::milliseconds RsmsRateController::next_token_wait() const {
+    // 有剩余令牌说明没有待发送数据或在途窗口已满，等待确认唤醒即可
+    double wait_ms = tokens_ >= 1.0 ? 100.0 : (1.0 - tokens_) * 1000.0 / rate_;
+    return std::chrono::milliseconds(static_cast<long long>(std::min(100.0, std::max(5.0, wait_ms))));
+}
@@ -0,0 +1,295 @@
+//
+// Created by hwyz_leo on 2025/9/4.
+//
+#include <algorithm>
+#include <iterator>
+
+#include "spdlog/spdlog.h"
+
+#include "rsms_reissue_codec.h"
+
+namespace {
+// 关键帧记录类型，数据单元以年份（0~99）开头，旧版本未编码的数据按关键帧处理
+const uint8_t kKeyframe = 0xF0;
+// 差分帧记录类型
+const uint8_t kDeltaFrame = 0xF1;
+// 相同字节少于该长度时并入不同字节段，避免游程头部开销大于收益
+const size_t kMinZeroRun = 3;
+
+void write_varint(std::vector<uint8_t> &out, size_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool read_varint(const std::vector<uint8_t> &in, size_t &pos, size_t &value) {
+    value = 0;
+    for (int shift = 0; pos < in.size() && shift < 35; shift += 7) {
+        uint8_t byte = in[pos++];
+        value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+RsmsReissueCodec::RsmsReissueCodec(std::unique_ptr<RsmsReissueStore> store, size_t keyframe_interval)
+        : store_(std::move(store)), keyframe_interval_(std::max<size_t>(keyframe_interval, 1)) {
+}
+
+bool RsmsReissueCodec::open() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_frame_.clear();
+    frames_since_keyframe_ = 0;
+    keyframes_.clear();
+    cached_frame_.clear();
+    if (!store_->open()) {
+        return false;
+    }
+    head_sequence_ = store_->head_sequence();
+    return true;
+}
+
+void RsmsReissueCodec::close() {
+    store_->close();
+    if (raw_bytes_ > 0) {
+        spdlog::info("补发数据原始[{}]字节，存储[{}]字节，压缩率[{:.2f}]", raw_bytes_.load(), stored_bytes_.load(),
+                     get_compression_ratio());
+    }
+}
+
+bool RsmsReissueCodec::append(const uint8_t *data, size_t length) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    static const std::vector<uint8_t> kNoPrevious;
+    bool is_delta_allowed = frames_since_keyframe_ + 1 < keyframe_interval_;
+    std::vector<uint8_t> record;
+    bool is_delta = encode(is_delta_allowed ? last_frame_ : kNoPrevious, data, length, record);
+    // 底层存储淘汰数据只会推进读指针，写入前计算的序号即为本条记录的序号
+    uint64_t sequence = store_->head_sequence() + store_->size();
+    if (!store_->append(record.data(), record.size())) {
+        // 上一条数据可能未写入，下一条从关键帧开始
+        last_frame_.clear();
+        return false;
+    }
+    last_frame_.assign(data, data + length);
+    if (is_delta) {
+        frames_since_keyframe_++;
+    } else {
+        frames_since_keyframe_ = 0;
+        keyframes_.insert(sequence);
+    }
+    raw_bytes_ += length;
+    stored_bytes_ += record.size();
+    return true;
+}
+
+size_t RsmsReissueCodec::peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                              uint64_t &out_sequence) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t store_head = store_->head_sequence();
+    sequence = std::max(sequence, std::max(head_sequence_, store_head));
+    out_sequence = sequence;
+    if (max_count == 0) {
+        return 0;
+    }
+    // 顺序读取时从上次解码的数据继续
+    if (!cached_frame_.empty() && cached_sequence_ + 1 == sequence) {
+        return decode_range(sequence, &cached_frame_, sequence, max_count, out_frames, out_sequence);
+    }
+    // 从不晚于起始序号的最近关键帧开始解码，未知时关键帧必然在最大间隔内
+    uint64_t start = sequence >= keyframe_interval_ - 1 ? sequence - (keyframe_interval_ - 1) : 0;
+    auto it = keyframes_.upper_bound(sequence);
+    if (it != keyframes_.begin() && *std::prev(it) >= store_head) {
+        start = *std::prev(it);
+    }
+    if (!cached_frame_.empty() && cached_sequence_ >= start && cached_sequence_ < sequence) {
+        return decode_range(cached_sequence_ + 1, &cached_frame_, sequence, max_count, out_frames, out_sequence);
+    }
+    return decode_range(start, nullptr, sequence, max_count, out_frames, out_sequence);
+}
+
+void RsmsReissueCodec::consume(uint64_t end_sequence) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (end_sequence <= head_sequence_) {
+        return;
+    }
+    head_sequence_ = end_sequence;
+    // 底层存储只消费到最近的关键帧，重启后最多重复补发关键帧间隔内的数据
+    auto it = keyframes_.upper_bound(end_sequence);
+    if (it == keyframes_.begin()) {
+        return;
+    }
+    --it;
+    store_->consume(*it);
+    keyframes_.erase(keyframes_.begin(), it);
+}
+
+uint64_t RsmsReissueCodec::head_sequence() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::max(head_sequence_, store_->head_sequence());
+}
+
+bool RsmsReissueCodec::sync() {
+    return store_->sync();
+}
+
+size_t RsmsReissueCodec::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t store_head = store_->head_sequence();
+    size_t count = store_->size();
+    uint64_t skipped = head_sequence_ > store_head ? head_sequence_ - store_head : 0;
+    return skipped < count ? count - static_cast<size_t>(skipped) : 0;
+}
+
+double RsmsReissueCodec::get_compression_ratio() const {
+    uint64_t stored_bytes = stored_bytes_;
+    return stored_bytes > 0 ? static_cast<double>(raw_bytes_) / static_cast<double>(stored_bytes) : 1.0;
+}
+
+bool RsmsReissueCodec::encode(const std::vector<uint8_t> &previous, const uint8_t *data, size_t length,
+                              std::vector<uint8_t> &out_record) {
+    out_record.clear();
+    if (length > 0 && previous.size() == length) {
+        out_record.push_back(kDeltaFrame);
+        size_t i = 0;
+        while (i < length && out_record.size() <= length) {
+            size_t zero_begin = i;
+            while (i < length && previous[i] == data[i]) {
+                i++;
+            }
+            if (i == length) {
+                // 末尾相同的部分不编码
+                break;
+            }
+            size_t literal_begin = i;
+            while (i < length) {
+                if (previous[i] != data[i]) {
+                    i++;
+                    continue;
+                }
+                size_t j = i;
+                while (j < length && previous[j] == data[j] && j - i < kMinZeroRun) {
+                    j++;
+                }
+                if (j == length || j - i >= kMinZeroRun) {
+                    break;
+                }
+                i = j;
+            }
+            write_varint(out_record, literal_begin - zero_begin);
+            write_varint(out_record, i - literal_begin);
+            for (size_t k = literal_begin; k < i; k++) {
+                out_record.push_back(previous[k] ^ data[k]);
+            }
+        }
+        if (out_record.size() <= length) {
+            return true;
+        }
+        out_record.clear();
+    }
+    out_record.reserve(length + 1);
+    out_record.push_back(kKeyframe);
+    out_record.insert(out_record.end(), data, data + length);
+    return false;
+}
+
+bool RsmsReissueCodec::decode(const std::vector<uint8_t> *previous, const std::vector<uint8_t> &record,
+                              std::vector<uint8_t> &out_data) {
+    if (record.empty()) {
+        out_data.clear();
+        return true;
+    }
+    if (record[0] == kKeyframe) {
+        out_data.assign(record.begin() + 1, record.end());
+        return true;
+    }
+    if (record[0] != kDeltaFrame) {
+        out_data = record;
+        return true;
+    }
+    if (previous == nullptr) {
+        return false;
+    }
+    out_data = *previous;
+    size_t pos = 1;
+    size_t offset = 0;
+    while (pos < record.size()) {
+        size_t zero_count = 0;
+        size_t literal_count = 0;
+        if (!read_varint(record, pos, zero_count) || !read_varint(record, pos, literal_count)) {
+            return false;
+        }
+        offset += zero_count;
+        if (offset + literal_count > out_data.size() || pos + literal_count > record.size()) {
+            return false;
+        }
+        for (size_t k = 0; k < literal_count; k++) {
+            out_data[offset++] ^= record[pos++];
+        }
+    }
+    return true;
+}
+
+bool RsmsReissueCodec::is_keyframe(const std::vector<uint8_t> &record) {
+    return record.empty() || record[0] != kDeltaFrame;
+}
+
+size_t RsmsReissueCodec::decode_range(uint64_t start, const std::vector<uint8_t> *previous, uint64_t sequence,
+                                      size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                                      uint64_t &out_sequence) {
+    std::vector<std::vector<uint8_t>> records;
+    uint64_t first = 0;
+    size_t read_count = store_->peek(start, static_cast<size_t>(sequence - std::min(start, sequence)) + max_count,
+                                     records, first);
+    std::vector<uint8_t> last;
+    bool has_last = previous != nullptr && first == start;
+    if (has_last) {
+        last = *previous;
+    }
+    uint64_t head = std::max(head_sequence_, store_->head_sequence());
+    size_t count = 0;
+    size_t skipped = 0;
+    for (size_t i = 0; i < read_count && count < max_count; i++) {
+        uint64_t record_sequence = first + i;
+        std::vector<uint8_t> frame;
+        if (!decode(has_last ? &last : nullptr, records[i], frame)) {
+            if (count > 0) {
+                spdlog::error("补发数据[{}]解码失败", record_sequence);
+                break;
+            }
+            has_last = false;
+            skipped += record_sequence >= sequence ? 1 : 0;
+            // 最早未消费的数据无法解码时直接跳过，避免补发停滞
+            if (record_sequence == head) {
+                head_sequence_ = ++head;
+            }
+            continue;
+        }
+        if (is_keyframe(records[i])) {
+            keyframes_.insert(record_sequence);
+        }
+        if (record_sequence >= sequence) {
+            if (count == 0) {
+                out_sequence = record_sequence;
+            }
+            out_frames.push_back(frame);
+            count++;
+        }
+        last.swap(frame);
+        has_last = true;
+        cached_sequence_ = record_sequence;
+    }
+    if (has_last) {
+        cached_frame_.swap(last);
+    } else {
+        cached_frame_.clear();
+    }
+    if (skipped > 0) {
+        spdlog::warn("补发数据关键帧已被淘汰，跳过无法解码的数据[{}]条", skipped);
+    }
+    return count;
+}
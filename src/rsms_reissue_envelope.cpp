@@ -0,0 +1,99 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+#include "crc32.h"
+#include "lz4_block.h"
+#include "rsms_reissue_envelope.h"
+
+namespace {
+const uint8_t kEnvelopeMagic0 = 0x52;
+const uint8_t kEnvelopeMagic1 = 0x42;
+const uint8_t kEnvelopeVersion = 0x01;
+// 报文区压缩前长度上限，防止损坏的信封申请过多内存
+const size_t kMaxBodyLength = 64 * 1024 * 1024;
+
+void write_be(uint32_t value, int bytes, std::vector<uint8_t> &out) {
+    for (int i = bytes - 1; i >= 0; i--) {
+        out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+uint32_t read_be(const uint8_t *data, int bytes) {
+    uint32_t value = 0;
+    for (int i = 0; i < bytes; i++) {
+        value = value << 8 | data[i];
+    }
+    return value;
+}
+}
+
+void pack_reissue_envelope(const std::vector<std::vector<uint8_t>> &frames, envelope_compression_t compression,
+                           std::vector<uint8_t> &out) {
+    std::vector<uint8_t> body;
+    for (const auto &frame: frames) {
+        write_be(static_cast<uint32_t>(frame.size()), 4, body);
+        body.insert(body.end(), frame.begin(), frame.end());
+    }
+    out.clear();
+    out.push_back(kEnvelopeMagic0);
+    out.push_back(kEnvelopeMagic1);
+    out.push_back(kEnvelopeVersion);
+    out.push_back(static_cast<uint8_t>(compression));
+    write_be(static_cast<uint32_t>(frames.size()), 2, out);
+    write_be(static_cast<uint32_t>(body.size()), 4, out);
+    write_be(calculate_crc32(body.data(), body.size()), 4, out);
+    if (compression == ENVELOPE_COMPRESSION_LZ4) {
+        lz4_compress_block(body.data(), body.size(), out);
+        if (out.size() - kEnvelopeHeaderLength < body.size()) {
+            return;
+        }
+        out.resize(kEnvelopeHeaderLength);
+        out[3] = ENVELOPE_COMPRESSION_NONE;
+    }
+    out.insert(out.end(), body.begin(), body.end());
+}
+
+bool unpack_reissue_envelope(const uint8_t *data, size_t length, std::vector<std::vector<uint8_t>> &frames) {
+    if (length < kEnvelopeHeaderLength || data[0] != kEnvelopeMagic0 || data[1] != kEnvelopeMagic1 ||
+        data[2] != kEnvelopeVersion) {
+        return false;
+    }
+    size_t count = read_be(data + 4, 2);
+    size_t body_length = read_be(data + 6, 4);
+    if (body_length > kMaxBodyLength) {
+        return false;
+    }
+    const uint8_t *body = data + kEnvelopeHeaderLength;
+    std::vector<uint8_t> buffer;
+    if (data[3] == ENVELOPE_COMPRESSION_LZ4) {
+        if (!lz4_decompress_block(body, length - kEnvelopeHeaderLength, body_length, buffer)) {
+            return false;
+        }
+        body = buffer.data();
+    } else if (data[3] != ENVELOPE_COMPRESSION_NONE || length - kEnvelopeHeaderLength != body_length) {
+        return false;
+    }
+    if (calculate_crc32(body, body_length) != read_be(data + 10, 4)) {
+        return false;
+    }
+    // 报文数量与报文区不符时撤回已追加的报文
+    size_t base = frames.size();
+    size_t position = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (body_length - position < 4) {
+            break;
+        }
+        size_t frame_length = read_be(body + position, 4);
+        position += 4;
+        if (body_length - position < frame_length) {
+            break;
+        }
+        frames.emplace_back(body + position, body + position + frame_length);
+        position += frame_length;
+    }
+    if (frames.size() - base != count || position != body_length) {
+        frames.resize(base);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,227 @@
+//
+// Created by hwyz_leo on 2025/9/5.
+//
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "spdlog/spdlog.h"
+
+#include "rsms_reissue_index.h"
+
+namespace {
+// 失效索引少于该数量时不重写索引文件
+const size_t kMinStaleCount = 64;
+}
+
+RsmsReissueIndex::RsmsReissueIndex(std::unique_ptr<RsmsReissueStore> store, std::string file_path,
+                                   int interval_second)
+        : store_(std::move(store)), file_path_(std::move(file_path)), interval_second_(interval_second) {
+}
+
+bool RsmsReissueIndex::open() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!store_->open()) {
+        return false;
+    }
+    entries_.clear();
+    stale_count_ = 0;
+    last_index_timestamp_ = -1;
+    uint64_t head = store_->head_sequence();
+    uint64_t tail = head + store_->size();
+    size_t total_count = 0;
+    FILE *file = std::fopen(file_path_.c_str(), "rb");
+    if (file != nullptr) {
+        index_entry_t entry{};
+        while (std::fread(&entry, sizeof(entry), 1, file) == 1) {
+            total_count++;
+            // 只保留未消费数据范围内、时间与序号都递增的索引
+            if (entry.sequence < head || entry.sequence >= tail) {
+                continue;
+            }
+            if (!entries_.empty() && (entry.sequence <= entries_.back().sequence ||
+                                      entry.timestamp <= entries_.back().timestamp)) {
+                continue;
+            }
+            entries_.push_back(entry);
+        }
+        std::fclose(file);
+    }
+    if (!entries_.empty()) {
+        last_index_timestamp_ = entries_.back().timestamp;
+    }
+    // 截断的索引或失效的索引通过重写清理
+    if (total_count != entries_.size() || file == nullptr) {
+        rewrite();
+    } else {
+        fd_ = ::open(file_path_.c_str(), O_WRONLY | O_APPEND, 0644);
+    }
+    spdlog::info("补发数据时间索引加载完成，数量[{}]", entries_.size());
+    return true;
+}
+
+void RsmsReissueIndex::close() {
+    store_->close();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool RsmsReissueIndex::append(const uint8_t *data, size_t length) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 底层存储淘汰数据只会推进读指针，写入前计算的序号即为本条记录的序号
+    uint64_t sequence = store_->head_sequence() + store_->size();
+    if (!store_->append(data, length)) {
+        return false;
+    }
+    long long timestamp = get_frame_time(data, length);
+    if (timestamp < 0 || (last_index_timestamp_ >= 0 && timestamp < last_index_timestamp_ + interval_second_)) {
+        return true;
+    }
+    index_entry_t entry{timestamp, sequence};
+    entries_.push_back(entry);
+    last_index_timestamp_ = timestamp;
+    if (fd_ >= 0 && ::write(fd_, &entry, sizeof(entry)) != static_cast<ssize_t>(sizeof(entry))) {
+        spdlog::warn("补发数据时间索引写入失败");
+    }
+    drop_consumed();
+    return true;
+}
+
+size_t RsmsReissueIndex::peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                              uint64_t &out_sequence) {
+    return store_->peek(sequence, max_count, out_frames, out_sequence);
+}
+
+void RsmsReissueIndex::consume(uint64_t end_sequence) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    store_->consume(end_sequence);
+    drop_consumed();
+}
+
+uint64_t RsmsReissueIndex::head_sequence() {
+    return store_->head_sequence();
+}
+
+bool RsmsReissueIndex::sync() {
+    return store_->sync();
+}
+
+size_t RsmsReissueIndex::size() {
+    return store_->size();
+}
+
+uint64_t RsmsReissueIndex::seek(long long timestamp) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t head = store_->head_sequence();
+    size_t index = upper_bound(timestamp);
+    if (index == 0) {
+        return head;
+    }
+    return std::max(head, entries_[index - 1].sequence);
+}
+
+uint64_t RsmsReissueIndex::seek_end(long long timestamp) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t head = store_->head_sequence();
+    size_t index = upper_bound(timestamp);
+    if (index == entries_.size()) {
+        return head + store_->size();
+    }
+    return std::max(head, entries_[index].sequence);
+}
+
+size_t RsmsReissueIndex::trim(long long timestamp) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t index = upper_bound(timestamp);
+    if (index == 0) {
+        return 0;
+    }
+    uint64_t head = store_->head_sequence();
+    uint64_t end_sequence = entries_[index - 1].sequence;
+    if (end_sequence <= head) {
+        return 0;
+    }
+    size_t count = store_->size();
+    store_->consume(end_sequence);
+    drop_consumed();
+    count -= std::min(count, store_->size());
+    spdlog::info("清理采集时间早于[{}]的补发数据[{}]条", timestamp, count);
+    return count;
+}
+
+long long RsmsReissueIndex::get_frame_time(const uint8_t *data, size_t length) {
+    if (length < 6 || data[0] > 99 || data[1] < 1 || data[1] > 12 || data[2] < 1 || data[2] > 31 ||
+        data[3] > 23 || data[4] > 59 || data[5] > 59) {
+        return -1;
+    }
+    std::tm local_time{};
+    local_time.tm_year = data[0] + 100;
+    local_time.tm_mon = data[1] - 1;
+    local_time.tm_mday = data[2];
+    local_time.tm_hour = data[3];
+    local_time.tm_min = data[4];
+    local_time.tm_sec = data[5];
+    local_time.tm_isdst = -1;
+    return static_cast<long long>(std::mktime(&local_time));
+}
+
+size_t RsmsReissueIndex::upper_bound(long long timestamp) const {
+    size_t low = 0;
+    size_t high = entries_.size();
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (entries_[middle].timestamp <= timestamp) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+void RsmsReissueIndex::drop_consumed() {
+    uint64_t head = store_->head_sequence();
+    // 保留不晚于读指针的最后一条索引，用于定位读指针之后、下一条索引之前的数据
+    while (entries_.size() > 1 && entries_[1].sequence <= head) {
+        entries_.pop_front();
+        stale_count_++;
+    }
+    if (stale_count_ >= kMinStaleCount && stale_count_ > entries_.size()) {
+        rewrite();
+    }
+}
+
+bool RsmsReissueIndex::rewrite() {
+    std::string temp_path = file_path_ + ".tmp";
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        spdlog::error("无法创建补发数据时间索引文件[{}]", temp_path);
+        return false;
+    }
+    bool is_success = true;
+    for (const auto &entry: entries_) {
+        if (::write(fd, &entry, sizeof(entry)) != static_cast<ssize_t>(sizeof(entry))) {
+            is_success = false;
+            break;
+        }
+    }
+    ::close(fd);
+    if (!is_success || std::rename(temp_path.c_str(), file_path_.c_str()) != 0) {
+        spdlog::error("重写补发数据时间索引文件[{}]失败", file_path_);
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    fd_ = ::open(file_path_.c_str(), O_WRONLY | O_APPEND, 0644);
+    stale_count_ = 0;
+    return true;
+}
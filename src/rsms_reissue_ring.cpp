@@ -0,0 +1,447 @@
+//
+// Created by hwyz_leo on 2025/8/30.
+//
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "spdlog/spdlog.h"
+
+#include "crc32.h"
+#include "rsms_reissue_ring.h"
+
+namespace {
+// 记录魔数
+const uint32_t kRecordMagic = 0x52534D52;
+// 元数据魔数
+const uint32_t kMetaMagic = 0x52534D4D;
+// 元数据版本
+const uint32_t kMetaVersion = 1;
+// 数据记录
+const uint32_t kRecordFlagFrame = 0;
+// 回绕标记，后续记录从数据区起始位置继续
+const uint32_t kRecordFlagWrap = 1;
+// 稀疏位置的序号间隔
+const uint64_t kPositionInterval = 64;
+
+// 记录头
+struct record_header_t {
+    uint32_t magic; // 魔数
+    uint32_t length; // 数据长度
+    uint64_t sequence; // 序号
+    uint32_t flags; // 记录类型
+    uint32_t crc; // 记录头（不含本字段）与数据的CRC32
+};
+
+// 元数据
+struct meta_t {
+    uint32_t magic; // 魔数
+    uint32_t version; // 版本
+    uint64_t generation; // 代数
+    uint64_t capacity; // 存储文件大小
+    uint64_t head_offset; // 最早未消费记录的偏移
+    uint64_t head_sequence; // 最早未消费记录的序号
+    uint32_t reserved; // 保留
+    uint32_t crc; // 元数据（不含本字段）的CRC32
+};
+
+const uint64_t kRecordHeaderBytes = sizeof(record_header_t);
+
+uint64_t record_span(uint64_t length) {
+    return (kRecordHeaderBytes + length + 7) & ~static_cast<uint64_t>(7);
+}
+
+uint32_t record_crc(const record_header_t &header, const uint8_t *data) {
+    uint32_t crc = calculate_crc32(reinterpret_cast<const uint8_t *>(&header), offsetof(record_header_t, crc));
+    return calculate_crc32(data, header.length, crc);
+}
+
+uint32_t meta_crc(const meta_t &meta) {
+    return calculate_crc32(reinterpret_cast<const uint8_t *>(&meta), offsetof(meta_t, crc));
+}
+}
+
+RsmsReissueRing::RsmsReissueRing(std::string file_path, size_t capacity_bytes, int sync_interval_ms)
+        : file_path_(std::move(file_path)), capacity_bytes_(capacity_bytes), sync_interval_ms_(sync_interval_ms) {}
+
+RsmsReissueRing::~RsmsReissueRing() {
+    close();
+}
+
+bool RsmsReissueRing::open() {
+    if (is_opened_) {
+        return true;
+    }
+    long page_bytes = ::sysconf(_SC_PAGESIZE);
+    if (page_bytes > 0) {
+        sector_bytes_ = static_cast<size_t>(page_bytes);
+    }
+    // 两个元数据扇区，数据区至少14个扇区
+    size_t file_bytes = std::max(capacity_bytes_, sector_bytes_ * 16);
+    file_bytes = (file_bytes + sector_bytes_ - 1) / sector_bytes_ * sector_bytes_;
+    fd_ = ::open(file_path_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        spdlog::error("打开补发存储文件[{}]失败[{}]", file_path_, std::strerror(errno));
+        return false;
+    }
+    data_begin_ = sector_bytes_ * 2;
+    data_end_ = file_bytes;
+    std::lock_guard<std::mutex> lock(mutex_);
+    struct stat st{};
+    if (::fstat(fd_, &st) == 0 && static_cast<size_t>(st.st_size) == file_bytes) {
+        void *base = ::mmap(nullptr, file_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (base != MAP_FAILED) {
+            base_ = static_cast<uint8_t *>(base);
+            if (!load_meta()) {
+                ::munmap(base_, file_bytes);
+                base_ = nullptr;
+            }
+        }
+    }
+    if (base_ == nullptr) {
+        // 新建、大小变化或元数据损坏时清零重建，避免旧记录被误认为有效
+        spdlog::warn("补发存储文件[{}]无有效数据，按[{}]字节重新初始化", file_path_, file_bytes);
+        int rc = ::ftruncate(fd_, 0);
+#ifdef __linux__
+        rc = rc == 0 ? ::posix_fallocate(fd_, 0, static_cast<off_t>(file_bytes)) : rc;
+#else
+        rc = rc == 0 ? ::ftruncate(fd_, static_cast<off_t>(file_bytes)) : rc;
+#endif
+        void *base = rc == 0 ? ::mmap(nullptr, file_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0) : MAP_FAILED;
+        if (base == MAP_FAILED) {
+            spdlog::error("初始化补发存储文件[{}]失败[{}]", file_path_, std::strerror(errno));
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+        base_ = static_cast<uint8_t *>(base);
+        head_offset_ = data_begin_;
+        head_sequence_ = 1;
+        meta_generation_ = 0;
+        save_meta();
+    }
+    // 从读指针开始按序号连续扫描，序号不连续或校验失败处即为写指针
+    uint64_t offset = head_offset_;
+    uint64_t sequence = head_sequence_;
+    count_ = 0;
+    used_bytes_ = 0;
+    positions_.clear();
+    while (used_bytes_ < data_end_ - data_begin_) {
+        uint64_t record = is_wrap(offset, sequence) ? data_begin_ : offset;
+        uint64_t next = 0;
+        if (!check_record(record, sequence, next)) {
+            break;
+        }
+        add_position(sequence, record);
+        used_bytes_ += (record == offset ? 0 : data_end_ - offset) + (next - record);
+        offset = next;
+        sequence++;
+        count_++;
+    }
+    tail_offset_ = offset;
+    tail_sequence_ = sequence;
+    lagging_bytes_ = 0;
+    spdlog::info("补发存储打开完成，未消费记录[{}]条，占用[{}/{}]字节", count_, used_bytes_, data_end_ - data_begin_);
+    is_opened_ = true;
+    sync_thread_ = std::thread(&RsmsReissueRing::sync_thread, this);
+    return true;
+}
+
+void RsmsReissueRing::close() {
+    if (!is_opened_) {
+        return;
+    }
+    is_opened_ = false;
+    cv_sync_.notify_all();
+    if (sync_thread_.joinable()) {
+        sync_thread_.join();
+    }
+    flush();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (base_ != nullptr) {
+        ::munmap(base_, data_end_);
+        base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool RsmsReissueRing::append(const uint8_t *data, size_t length) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t data_bytes = data_end_ - data_begin_;
+    uint64_t span = record_span(length);
+    if (base_ == nullptr || length == 0 || span > data_bytes / 4) {
+        return false;
+    }
+    // 写指针后的剩余空间放不下时填充到数据区末尾，从起始位置继续写
+    bool is_wrapping = data_end_ - tail_offset_ < span;
+    uint64_t pad = is_wrapping ? data_end_ - tail_offset_ : 0;
+    uint64_t need = pad + span;
+    if (data_bytes - used_bytes_ < need) {
+        // 后台线程未及提前淘汰时才在追加时淘汰，一次多淘汰一段空间，减少元数据写入次数
+        evict(need + data_bytes / 16);
+    }
+    // 将要覆盖的空间在落盘的读指针之后时，先落盘读指针，保证掉电后从读指针扫描得到的记录有效
+    if (data_bytes - used_bytes_ - lagging_bytes_ < need && !save_meta()) {
+        return false;
+    }
+    if (is_wrapping) {
+        if (pad >= kRecordHeaderBytes) {
+            record_header_t marker{kRecordMagic, 0, tail_sequence_, kRecordFlagWrap, 0};
+            marker.crc = record_crc(marker, nullptr);
+            std::memcpy(base_ + tail_offset_, &marker, sizeof(marker));
+            mark_dirty(tail_offset_, tail_offset_ + sizeof(marker));
+        }
+        used_bytes_ += pad;
+        tail_offset_ = data_begin_;
+    }
+    record_header_t header{kRecordMagic, static_cast<uint32_t>(length), tail_sequence_, kRecordFlagFrame, 0};
+    header.crc = record_crc(header, data);
+    std::memcpy(base_ + tail_offset_, &header, sizeof(header));
+    std::memcpy(base_ + tail_offset_ + kRecordHeaderBytes, data, length);
+    add_position(tail_sequence_, tail_offset_);
+    mark_dirty(tail_offset_, tail_offset_ + kRecordHeaderBytes + length);
+    tail_offset_ += span;
+    tail_sequence_++;
+    used_bytes_ += span;
+    count_++;
+    return true;
+}
+
+size_t RsmsReissueRing::peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                             uint64_t &out_sequence) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    out_sequence = std::max(sequence, head_sequence_);
+    if (base_ == nullptr) {
+        return 0;
+    }
+    // 从不晚于起始序号的最近位置开始，位置表为空或起始序号早于第一条位置时从读指针开始
+    uint64_t record = head_offset_;
+    uint64_t record_sequence = head_sequence_;
+    auto it = std::upper_bound(positions_.begin(), positions_.end(), out_sequence,
+                               [](uint64_t value, const position_t &position) {
+                                   return value < position.sequence;
+                               });
+    if (it != positions_.begin()) {
+        --it;
+        record = it->offset;
+        record_sequence = it->sequence;
+    }
+    size_t count = 0;
+    for (; record_sequence < tail_sequence_ && count < max_count; record_sequence++) {
+        if (is_wrap(record, record_sequence)) {
+            record = data_begin_;
+        }
+        record_header_t header{};
+        std::memcpy(&header, base_ + record, sizeof(header));
+        uint64_t next = record + record_span(header.length);
+        if (record_sequence >= out_sequence) {
+            if (!check_record(record, record_sequence, next)) {
+                spdlog::error("补发存储记录[{}]校验失败", record_sequence);
+                break;
+            }
+            const uint8_t *data = base_ + record + kRecordHeaderBytes;
+            out_frames.emplace_back(data, data + header.length);
+            count++;
+        }
+        record = next;
+    }
+    return count;
+}
+
+void RsmsReissueRing::consume(uint64_t end_sequence) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (base_ == nullptr || end_sequence <= head_sequence_) {
+        return;
+    }
+    size_t count = static_cast<size_t>(std::min<uint64_t>(end_sequence - head_sequence_, count_));
+    for (size_t i = 0; i < count; i++) {
+        lagging_bytes_ += pop_head();
+    }
+    is_meta_dirty_ = is_meta_dirty_ || count > 0;
+}
+
+uint64_t RsmsReissueRing::head_sequence() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return head_sequence_;
+}
+
+bool RsmsReissueRing::sync() {
+    return flush();
+}
+
+size_t RsmsReissueRing::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return count_;
+}
+
+bool RsmsReissueRing::is_wrap(uint64_t offset, uint64_t sequence) const {
+    if (data_end_ - offset < kRecordHeaderBytes) {
+        return true;
+    }
+    record_header_t header{};
+    std::memcpy(&header, base_ + offset, sizeof(header));
+    return header.magic == kRecordMagic && header.flags == kRecordFlagWrap && header.sequence == sequence &&
+           header.crc == record_crc(header, nullptr);
+}
+
+bool RsmsReissueRing::check_record(uint64_t offset, uint64_t sequence, uint64_t &out_next) const {
+    if (offset < data_begin_ || data_end_ - offset < kRecordHeaderBytes) {
+        return false;
+    }
+    record_header_t header{};
+    std::memcpy(&header, base_ + offset, sizeof(header));
+    if (header.magic != kRecordMagic || header.flags != kRecordFlagFrame || header.sequence != sequence ||
+        header.length == 0 || record_span(header.length) > data_end_ - offset) {
+        return false;
+    }
+    if (header.crc != record_crc(header, base_ + offset + kRecordHeaderBytes)) {
+        return false;
+    }
+    out_next = offset + record_span(header.length);
+    return true;
+}
+
+void RsmsReissueRing::mark_dirty(uint64_t begin, uint64_t end) {
+    if (!dirty_ranges_.empty() && dirty_ranges_.back().second == begin) {
+        dirty_ranges_.back().second = end;
+    } else if (dirty_ranges_.size() >= 4) {
+        // 两次落盘之间多次回绕时整个数据区落盘
+        dirty_ranges_.assign(1, std::make_pair(data_begin_, data_end_));
+    } else {
+        dirty_ranges_.emplace_back(begin, end);
+    }
+}
+
+size_t RsmsReissueRing::evict(uint64_t free_bytes) {
+    uint64_t data_bytes = data_end_ - data_begin_;
+    size_t evicted = 0;
+    while (count_ > 0 && data_bytes - used_bytes_ < free_bytes) {
+        lagging_bytes_ += pop_head();
+        evicted++;
+    }
+    if (evicted > 0) {
+        evicted_count_ += evicted;
+        is_meta_dirty_ = true;
+        spdlog::warn("补发存储空间不足，淘汰最早的记录[{}]条，累计淘汰[{}]条", evicted, evicted_count_);
+    }
+    return evicted;
+}
+
+void RsmsReissueRing::add_position(uint64_t sequence, uint64_t offset) {
+    if (sequence % kPositionInterval == 0) {
+        positions_.push_back({sequence, offset});
+    }
+}
+
+uint64_t RsmsReissueRing::pop_head() {
+    uint64_t released = 0;
+    if (is_wrap(head_offset_, head_sequence_)) {
+        released += data_end_ - head_offset_;
+        head_offset_ = data_begin_;
+    }
+    record_header_t header{};
+    std::memcpy(&header, base_ + head_offset_, sizeof(header));
+    uint64_t span = record_span(header.length);
+    released += span;
+    head_offset_ += span;
+    head_sequence_++;
+    used_bytes_ -= released;
+    count_--;
+    while (!positions_.empty() && positions_.front().sequence < head_sequence_) {
+        positions_.pop_front();
+    }
+    return released;
+}
+
+bool RsmsReissueRing::load_meta() {
+    bool is_found = false;
+    for (int slot = 0; slot < 2; slot++) {
+        meta_t meta{};
+        std::memcpy(&meta, base_ + slot * sector_bytes_, sizeof(meta));
+        if (meta.magic != kMetaMagic || meta.version != kMetaVersion || meta.crc != meta_crc(meta) ||
+            meta.capacity != data_end_ || meta.head_offset < data_begin_ || meta.head_offset > data_end_) {
+            continue;
+        }
+        if (!is_found || meta.generation > meta_generation_) {
+            meta_generation_ = meta.generation;
+            head_offset_ = meta.head_offset;
+            head_sequence_ = meta.head_sequence;
+            is_found = true;
+        }
+    }
+    return is_found;
+}
+
+bool RsmsReissueRing::save_meta() {
+    meta_t meta{kMetaMagic, kMetaVersion, meta_generation_ + 1, data_end_, head_offset_, head_sequence_, 0, 0};
+    meta.crc = meta_crc(meta);
+    // 两个元数据扇区交替写入，写入中掉电时另一个扇区仍然有效
+    uint8_t *slot = base_ + (meta.generation % 2) * sector_bytes_;
+    std::memcpy(slot, &meta, sizeof(meta));
+    if (::msync(slot, sector_bytes_, MS_SYNC) != 0) {
+        spdlog::error("补发存储元数据落盘失败[{}]", std::strerror(errno));
+        return false;
+    }
+    meta_generation_ = meta.generation;
+    lagging_bytes_ = 0;
+    is_meta_dirty_ = false;
+    return true;
+}
+
+bool RsmsReissueRing::flush() {
+    std::lock_guard<std::mutex> sync_lock(sync_mutex_);
+    // 数据区落盘不持有存储锁，不阻塞追加
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (base_ == nullptr) {
+            return false;
+        }
+        // 运行中剩余空间低于1/8时提前淘汰，读指针随后落盘，追加时不必等待落盘
+        uint64_t data_bytes = data_end_ - data_begin_;
+        if (is_opened_ && data_bytes - used_bytes_ < data_bytes / 8) {
+            evict(data_bytes / 8 + data_bytes / 16);
+        }
+        ranges.swap(dirty_ranges_);
+    }
+    bool is_success = true;
+    size_t synced = 0;
+    for (; synced < ranges.size(); synced++) {
+        // 映射起始地址按页对齐，扇区大小取页大小
+        uint64_t begin = ranges[synced].first / sector_bytes_ * sector_bytes_;
+        uint64_t end = std::min<uint64_t>(data_end_, (ranges[synced].second + sector_bytes_ - 1) / sector_bytes_ *
+                                                     sector_bytes_);
+        if (::msync(base_ + begin, end - begin, MS_SYNC) != 0) {
+            is_success = false;
+            break;
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!is_success) {
+        spdlog::error("补发存储数据落盘失败[{}]", std::strerror(errno));
+        dirty_ranges_.insert(dirty_ranges_.begin(), ranges.begin() + static_cast<long>(synced), ranges.end());
+    }
+    if (is_meta_dirty_) {
+        is_success = save_meta() && is_success;
+    }
+    return is_success;
+}
+
+void RsmsReissueRing::sync_thread() {
+    while (is_opened_) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_sync_.wait_for(lock, std::chrono::milliseconds(sync_interval_ms_));
+        }
+        flush();
+    }
+}
@@ -0,0 +1,561 @@
+//
+// Created by hwyz_leo on 2025/8/29.
+//
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "spdlog/spdlog.h"
+
+#include "crc32.h"
+#include "rsms_reissue_wal.h"
+
+namespace {
+// 记录头长度：长度（4字节）+ CRC32（4字节）
+const size_t kRecordHeaderBytes = 8;
+// 单条记录数据长度上限
+const uint32_t kMaxRecordBytes = 64 * 1024;
+// 读取位置所在段之后预读的段数量
+const size_t kPrefetchSegments = 1;
+
+int sync_fd(int fd) {
+#ifdef __APPLE__
+    return ::fsync(fd);
+#else
+    return ::fdatasync(fd);
+#endif
+}
+
+void write_u32(uint8_t *out, uint32_t value) {
+    out[0] = static_cast<uint8_t>(value & 0xFF);
+    out[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
+    out[2] = static_cast<uint8_t>((value >> 16) & 0xFF);
+    out[3] = static_cast<uint8_t>((value >> 24) & 0xFF);
+}
+
+uint32_t read_u32(const uint8_t *in) {
+    return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) |
+           (static_cast<uint32_t>(in[2]) << 16) | (static_cast<uint32_t>(in[3]) << 24);
+}
+}
+
+RsmsReissueWal::RsmsReissueWal(std::string dir_path, size_t segment_bytes, int sync_interval_ms)
+        : dir_path_(std::move(dir_path)), segment_bytes_(segment_bytes), sync_interval_ms_(sync_interval_ms) {}
+
+RsmsReissueWal::~RsmsReissueWal() {
+    close();
+}
+
+bool RsmsReissueWal::open() {
+    if (is_opened_) {
+        return true;
+    }
+    if (::mkdir(dir_path_.c_str(), 0755) != 0 && errno != EEXIST) {
+        spdlog::error("创建补发日志目录[{}]失败[{}]", dir_path_, std::strerror(errno));
+        return false;
+    }
+    std::vector<uint64_t> segments;
+    DIR *dir = ::opendir(dir_path_.c_str());
+    if (dir == nullptr) {
+        spdlog::error("打开补发日志目录[{}]失败[{}]", dir_path_, std::strerror(errno));
+        return false;
+    }
+    while (struct dirent *entry = ::readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".seg") == 0) {
+            segments.push_back(std::strtoull(name.c_str(), nullptr, 10));
+        }
+    }
+    ::closedir(dir);
+    std::sort(segments.begin(), segments.end());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    load_cursor();
+    if (segments.empty()) {
+        cursor_ = {std::max<uint64_t>(cursor_.segment, 1), 0};
+        segments.push_back(cursor_.segment);
+    } else if (cursor_.segment < segments.front()) {
+        // 游标所在段已不存在，从最早的段开始，序号以该段的序号文件为准
+        cursor_ = {segments.front(), 0};
+        uint64_t sequence = 0;
+        if (load_segment_sequence(cursor_.segment, sequence)) {
+            head_sequence_ = sequence;
+        }
+    } else if (cursor_.segment > segments.back()) {
+        cursor_.offset = 0;
+        segments.push_back(cursor_.segment);
+    }
+    first_segment_ = segments.front();
+    // 游标读自文件，已经落盘
+    remove_consumed_segments(cursor_.segment);
+
+    segments_.clear();
+    segments.erase(segments.begin(), std::lower_bound(segments.begin(), segments.end(), cursor_.segment));
+    size_t scan_count = 0;
+    for (size_t i = 0; i < segments.size(); i++) {
+        segment_t info{segments[i], i == 0 ? cursor_.offset : 0, head_sequence_, 0, false, {}};
+        if (i > 0) {
+            info.first_sequence = segments_.back().first_sequence + segments_.back().count;
+        }
+        // 读游标所在段与最后一段需要扫描，中间段的记录数量由相邻段的序号得出
+        uint64_t sequence = 0;
+        uint64_t next_sequence = 0;
+        if (i > 0 && i + 1 < segments.size() && load_segment_sequence(segments[i], sequence) &&
+            load_segment_sequence(segments[i + 1], next_sequence) && next_sequence >= sequence) {
+            info.count = static_cast<size_t>(next_sequence - sequence);
+        } else {
+            uint64_t offset = scan_segment(info.segment, info.begin_offset, info.ends);
+            info.count = info.ends.size();
+            info.is_loaded = true;
+            scan_count++;
+            if (i + 1 == segments.size()) {
+                // 最后一段末尾可能是掉电时未写完的记录，截断后继续追加
+                if (::truncate(segment_path(info.segment).c_str(), static_cast<off_t>(offset)) != 0 &&
+                    errno != ENOENT) {
+                    spdlog::warn("截断补发日志段[{}]失败[{}]", info.segment, std::strerror(errno));
+                }
+                if (!open_segment(info.segment)) {
+                    return false;
+                }
+                write_offset_ = offset;
+            }
+        }
+        segments_.push_back(std::move(info));
+    }
+    read_sequence_ = head_sequence_;
+    spdlog::info("补发日志打开完成，未消费记录[{}]条，段[{}]个，扫描[{}]个，读游标[{}:{}]",
+                 segments_.back().first_sequence + segments_.back().count - head_sequence_, segments_.size(),
+                 scan_count, cursor_.segment, cursor_.offset);
+    is_opened_ = true;
+    sync_thread_ = std::thread(&RsmsReissueWal::sync_thread, this);
+    prefetch_thread_ = std::thread(&RsmsReissueWal::prefetch_thread, this);
+    return true;
+}
+
+void RsmsReissueWal::close() {
+    if (!is_opened_) {
+        return;
+    }
+    is_opened_ = false;
+    cv_sync_.notify_all();
+    cv_prefetch_.notify_all();
+    if (sync_thread_.joinable()) {
+        sync_thread_.join();
+    }
+    if (prefetch_thread_.joinable()) {
+        prefetch_thread_.join();
+    }
+    flush();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (write_fd_ >= 0) {
+        ::close(write_fd_);
+        write_fd_ = -1;
+    }
+    if (read_fd_ >= 0) {
+        ::close(read_fd_);
+        read_fd_ = -1;
+    }
+}
+
+bool RsmsReissueWal::append(const uint8_t *data, size_t length) {
+    if (length == 0 || length > kMaxRecordBytes) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (write_fd_ < 0) {
+        return false;
+    }
+    if (write_offset_ > 0 && write_offset_ + kRecordHeaderBytes + length > segment_bytes_) {
+        sync_fd(write_fd_);
+        // 记录新段第一条记录的序号，启动时不必扫描该段即可得出前一段的记录数量
+        uint64_t next_sequence = segments_.back().first_sequence + segments_.back().count;
+        if (!save_file(sequence_path(write_segment_ + 1), "sequence=" + std::to_string(next_sequence) + "\n")) {
+            spdlog::warn("保存补发日志段[{}]序号失败", write_segment_ + 1);
+        }
+        if (!open_segment(write_segment_ + 1)) {
+            return false;
+        }
+        segments_.push_back({write_segment_, 0, next_sequence, 0, true, {}});
+    }
+    uint8_t header[kRecordHeaderBytes];
+    write_u32(header, static_cast<uint32_t>(length));
+    write_u32(header + 4, calculate_crc32(data, length));
+    struct iovec iov[2];
+    iov[0].iov_base = header;
+    iov[0].iov_len = kRecordHeaderBytes;
+    iov[1].iov_base = const_cast<uint8_t *>(data);
+    iov[1].iov_len = length;
+    ssize_t written = ::writev(write_fd_, iov, 2);
+    if (written != static_cast<ssize_t>(kRecordHeaderBytes + length)) {
+        spdlog::error("写入补发日志失败[{}]", written < 0 ? std::strerror(errno) : "写入不完整");
+        if (written > 0 && ::ftruncate(write_fd_, static_cast<off_t>(write_offset_)) != 0) {
+            spdlog::error("回滚补发日志失败[{}]", std::strerror(errno));
+        }
+        return false;
+    }
+    write_offset_ += kRecordHeaderBytes + length;
+    segments_.back().ends.push_back(static_cast<uint32_t>(write_offset_));
+    segments_.back().count++;
+    is_data_dirty_ = true;
+    return true;
+}
+
+size_t RsmsReissueWal::peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                            uint64_t &out_sequence) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sequence = std::max(sequence, head_sequence_);
+    out_sequence = sequence;
+    size_t count = 0;
+    bool is_failed = false;
+    for (size_t index = find_segment(sequence); index < segments_.size() && count < max_count && !is_failed;
+         index++) {
+        if (!segments_[index].is_loaded) {
+            // 预读线程尚未加载时同步扫描
+            std::deque<uint32_t> ends;
+            scan_segment(segments_[index].segment, segments_[index].begin_offset, ends);
+            install_ends(index, std::move(ends));
+        }
+        const segment_t &info = segments_[index];
+        if (sequence < info.first_sequence || sequence >= info.first_sequence + info.count) {
+            continue;
+        }
+        if (read_fd_ < 0 || read_segment_ != info.segment) {
+            if (read_fd_ >= 0) {
+                ::close(read_fd_);
+            }
+            read_segment_ = info.segment;
+            read_fd_ = ::open(segment_path(info.segment).c_str(), O_RDONLY);
+            if (read_fd_ < 0) {
+                spdlog::error("读取补发日志段[{}]失败[{}]", info.segment, std::strerror(errno));
+                break;
+            }
+        }
+        for (size_t position = static_cast<size_t>(sequence - info.first_sequence);
+             position < info.ends.size() && count < max_count; position++) {
+            uint64_t start = position == 0 ? info.begin_offset : info.ends[position - 1];
+            std::vector<uint8_t> frame(info.ends[position] - start - kRecordHeaderBytes);
+            ssize_t n = ::pread(read_fd_, frame.data(), frame.size(), static_cast<off_t>(start + kRecordHeaderBytes));
+            if (n != static_cast<ssize_t>(frame.size())) {
+                spdlog::error("读取补发日志段[{}]偏移[{}]失败", info.segment, start);
+                is_failed = true;
+                break;
+            }
+            out_frames.push_back(std::move(frame));
+            count++;
+            sequence++;
+        }
+    }
+    if (count > 0) {
+        read_sequence_ = sequence;
+        cv_prefetch_.notify_one();
+    }
+    return count;
+}
+
+void RsmsReissueWal::consume(uint64_t end_sequence) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    end_sequence = std::min(end_sequence, segments_.back().first_sequence + segments_.back().count);
+    if (end_sequence <= head_sequence_) {
+        return;
+    }
+    while (segments_.size() > 1 && segments_.front().first_sequence + segments_.front().count <= end_sequence) {
+        segments_.pop_front();
+    }
+    if (!segments_.front().is_loaded) {
+        std::deque<uint32_t> ends;
+        scan_segment(segments_.front().segment, segments_.front().begin_offset, ends);
+        install_ends(0, std::move(ends));
+    }
+    segment_t &front = segments_.front();
+    size_t position = static_cast<size_t>(std::min<uint64_t>(end_sequence - std::min(end_sequence,
+                                                                                     front.first_sequence),
+                                                             front.ends.size()));
+    if (position > 0) {
+        front.begin_offset = front.ends[position - 1];
+        front.ends.erase(front.ends.begin(), front.ends.begin() + static_cast<long>(position));
+        front.count -= position;
+        front.first_sequence += position;
+    }
+    head_sequence_ = front.first_sequence;
+    cursor_ = {front.segment, front.begin_offset};
+    is_cursor_dirty_ = true;
+    // 已消费完的段由落盘时在读游标持久化后删除，掉电后游标不会指向已删除的段
+}
+
+uint64_t RsmsReissueWal::head_sequence() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return head_sequence_;
+}
+
+bool RsmsReissueWal::sync() {
+    return flush();
+}
+
+size_t RsmsReissueWal::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (segments_.empty()) {
+        return 0;
+    }
+    return static_cast<size_t>(segments_.back().first_sequence + segments_.back().count - head_sequence_);
+}
+
+std::string RsmsReissueWal::segment_path(uint64_t segment) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "/%010llu.seg", static_cast<unsigned long long>(segment));
+    return dir_path_ + name;
+}
+
+std::string RsmsReissueWal::sequence_path(uint64_t segment) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "/%010llu.seq", static_cast<unsigned long long>(segment));
+    return dir_path_ + name;
+}
+
+std::string RsmsReissueWal::cursor_path() const {
+    return dir_path_ + "/cursor";
+}
+
+void RsmsReissueWal::load_cursor() {
+    std::ifstream file(cursor_path());
+    if (!file.is_open()) {
+        return;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t delimiter_pos = line.find('=');
+        if (delimiter_pos == std::string::npos) {
+            continue;
+        }
+        std::string key = line.substr(0, delimiter_pos);
+        uint64_t value = std::strtoull(line.substr(delimiter_pos + 1).c_str(), nullptr, 10);
+        if (key == "segment") {
+            cursor_.segment = value;
+        } else if (key == "offset") {
+            cursor_.offset = value;
+        } else if (key == "sequence" && value > 0) {
+            head_sequence_ = value;
+        }
+    }
+}
+
+bool RsmsReissueWal::save_cursor(const position_t &cursor, uint64_t sequence) {
+    std::string content = "segment=" + std::to_string(cursor.segment) + "\noffset=" +
+                          std::to_string(cursor.offset) + "\nsequence=" + std::to_string(sequence) + "\n";
+    if (!save_file(cursor_path(), content)) {
+        spdlog::error("保存补发日志游标失败");
+        return false;
+    }
+    return true;
+}
+
+bool RsmsReissueWal::save_file(const std::string &path, const std::string &content) {
+    std::string temp_path = path + ".tmp";
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        spdlog::error("创建文件[{}]失败[{}]", temp_path, std::strerror(errno));
+        return false;
+    }
+    bool is_success = ::write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()) &&
+                      sync_fd(fd) == 0;
+    ::close(fd);
+    if (!is_success || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool RsmsReissueWal::load_segment_sequence(uint64_t segment, uint64_t &out_sequence) const {
+    std::ifstream file(sequence_path(segment));
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.compare(0, 9, "sequence=") == 0) {
+            out_sequence = std::strtoull(line.c_str() + 9, nullptr, 10);
+            return out_sequence > 0;
+        }
+    }
+    return false;
+}
+
+uint64_t RsmsReissueWal::scan_segment(uint64_t segment, uint64_t begin_offset, std::deque<uint32_t> &out_ends) const {
+    out_ends.clear();
+    std::ifstream file(segment_path(segment), std::ios::binary);
+    uint64_t offset = begin_offset;
+    file.seekg(static_cast<std::streamoff>(offset));
+    std::vector<uint8_t> header(kRecordHeaderBytes);
+    std::vector<uint8_t> frame;
+    while (file.is_open()) {
+        file.read(reinterpret_cast<char *>(header.data()), kRecordHeaderBytes);
+        if (file.gcount() != static_cast<std::streamsize>(kRecordHeaderBytes)) {
+            break;
+        }
+        uint32_t length = read_u32(header.data());
+        uint32_t crc = read_u32(header.data() + 4);
+        if (length == 0 || length > kMaxRecordBytes) {
+            break;
+        }
+        frame.resize(length);
+        file.read(reinterpret_cast<char *>(frame.data()), length);
+        if (file.gcount() != static_cast<std::streamsize>(length) || calculate_crc32(frame.data(), length) != crc) {
+            break;
+        }
+        offset += kRecordHeaderBytes + length;
+        out_ends.push_back(static_cast<uint32_t>(offset));
+    }
+    return offset;
+}
+
+void RsmsReissueWal::install_ends(size_t index, std::deque<uint32_t> &&ends) {
+    segment_t &info = segments_[index];
+    if (ends.size() != info.count) {
+        spdlog::error("补发日志段[{}]记录数量[{}]与预期[{}]不一致", info.segment, ends.size(), info.count);
+        uint64_t delta = static_cast<uint64_t>(ends.size()) - static_cast<uint64_t>(info.count);
+        info.count = ends.size();
+        for (size_t i = index + 1; i < segments_.size(); i++) {
+            segments_[i].first_sequence += delta;
+        }
+    }
+    info.ends = std::move(ends);
+    info.is_loaded = true;
+}
+
+size_t RsmsReissueWal::find_segment(uint64_t sequence) const {
+    size_t low = 0;
+    size_t high = segments_.size();
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (segments_[middle].first_sequence + segments_[middle].count <= sequence) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+bool RsmsReissueWal::open_segment(uint64_t segment) {
+    std::string path = segment_path(segment);
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) {
+        spdlog::error("打开补发日志段[{}]失败[{}]", path, std::strerror(errno));
+        return false;
+    }
+    if (write_fd_ >= 0) {
+        ::close(write_fd_);
+    }
+    write_fd_ = fd;
+    write_segment_ = segment;
+    write_offset_ = 0;
+    return true;
+}
+
+void RsmsReissueWal::remove_consumed_segments(uint64_t end_segment) {
+    while (first_segment_ < end_segment) {
+        ::unlink(segment_path(first_segment_).c_str());
+        ::unlink(sequence_path(first_segment_).c_str());
+        first_segment_++;
+    }
+}
+
+bool RsmsReissueWal::flush() {
+    std::lock_guard<std::mutex> sync_lock(sync_mutex_);
+    // 持有日志锁时只取快照，fsync期间不阻塞追加
+    int fd = -1;
+    bool is_cursor_dirty;
+    position_t cursor{};
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (is_data_dirty_ && write_fd_ >= 0) {
+            fd = ::dup(write_fd_);
+            is_data_dirty_ = false;
+        }
+        is_cursor_dirty = is_cursor_dirty_;
+        is_cursor_dirty_ = false;
+        cursor = cursor_;
+        sequence = head_sequence_;
+    }
+    bool is_success = true;
+    if (fd >= 0) {
+        is_success = sync_fd(fd) == 0;
+        ::close(fd);
+    }
+    if (is_cursor_dirty) {
+        if (save_cursor(cursor, sequence)) {
+            remove_consumed_segments(cursor.segment);
+        } else {
+            is_success = false;
+        }
+    }
+    if (!is_success) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_data_dirty_ = true;
+        is_cursor_dirty_ = true;
+    }
+    return is_success;
+}
+
+void RsmsReissueWal::sync_thread() {
+    while (is_opened_) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_sync_.wait_for(lock, std::chrono::milliseconds(sync_interval_ms_));
+        }
+        flush();
+    }
+}
+
+void RsmsReissueWal::prefetch_thread() {
+    while (is_opened_) {
+        uint64_t segment = 0;
+        uint64_t begin_offset = 0;
+        bool has_target = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_prefetch_.wait_for(lock, std::chrono::seconds(1));
+            if (!is_opened_ || segments_.empty()) {
+                continue;
+            }
+            size_t read_index = std::min(find_segment(std::max(read_sequence_, head_sequence_)),
+                                         segments_.size() - 1);
+            // 读游标到读取位置之间的段用于重新发送，读取位置之后只保留预读的段，最后一段用于追加
+            for (size_t i = read_index + kPrefetchSegments + 1; i + 1 < segments_.size(); i++) {
+                if (segments_[i].is_loaded) {
+                    std::deque<uint32_t>().swap(segments_[i].ends);
+                    segments_[i].is_loaded = false;
+                }
+            }
+            for (size_t i = read_index; i <= read_index + kPrefetchSegments && i < segments_.size(); i++) {
+                if (!segments_[i].is_loaded) {
+                    segment = segments_[i].segment;
+                    begin_offset = segments_[i].begin_offset;
+                    has_target = true;
+                    break;
+                }
+            }
+        }
+        if (!has_target) {
+            continue;
+        }
+        // 已写满的段不再变化，不持有锁扫描
+        std::deque<uint32_t> ends;
+        scan_segment(segment, begin_offset, ends);
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < segments_.size(); i++) {
+            if (segments_[i].segment == segment) {
+                if (!segments_[i].is_loaded && segments_[i].begin_offset == begin_offset) {
+                    install_ends(i, std::move(ends));
+                }
+                break;
+            }
+        }
+    }
+}
@@ -6,6 +6,98 @@
 
 #include "rsms_signal_cache.h"
 
+const signal_define_t kSignalDefines[] = {
+        {SIGNAL_VEHICLE_STATE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_CHARGING_STATE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_RUNNING_MODE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_SPEED, SIGNAL_TYPE_WORD},
+        {SIGNAL_TOTAL_ODOMETER, SIGNAL_TYPE_DWORD},
+        {SIGNAL_TOTAL_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_TOTAL_CURRENT, SIGNAL_TYPE_WORD},
+        {SIGNAL_SOC, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DCDC_STATE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DRIVING, SIGNAL_TYPE_BOOLEAN},
+        {SIGNAL_BRAKING, SIGNAL_TYPE_BOOLEAN},
+        {SIGNAL_GEAR, SIGNAL_TYPE_BYTE},
+        {SIGNAL_INSULATION_RESISTANCE, SIGNAL_TYPE_WORD},
+        {SIGNAL_ACCELERATOR_PEDAL_POSITION, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BRAKE_PEDAL_POSITION, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DM1_STATE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DM1_CONTROLLER_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DM1_SPEED, SIGNAL_TYPE_WORD},
+        {SIGNAL_DM1_TORQUE, SIGNAL_TYPE_WORD},
+        {SIGNAL_DM1_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DM1_CONTROLLER_INPUT_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_DM1_CONTROLLER_DC_BUS_CURRENT, SIGNAL_TYPE_WORD},
+        {SIGNAL_DM2_STATE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DM2_CONTROLLER_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DM2_SPEED, SIGNAL_TYPE_WORD},
+        {SIGNAL_DM2_TORQUE, SIGNAL_TYPE_WORD},
+        {SIGNAL_DM2_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DM2_CONTROLLER_INPUT_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_DM2_CONTROLLER_DC_BUS_CURRENT, SIGNAL_TYPE_WORD},
+        {SIGNAL_POSITION_VALID, SIGNAL_TYPE_BOOLEAN},
+        {SIGNAL_SOUTH_LATITUDE, SIGNAL_TYPE_BOOLEAN},
+        {SIGNAL_WEST_LONGITUDE, SIGNAL_TYPE_BOOLEAN},
+        {SIGNAL_LONGITUDE, SIGNAL_TYPE_DWORD},
+        {SIGNAL_LATITUDE, SIGNAL_TYPE_DWORD},
+        {SIGNAL_MAX_VOLTAGE_BATTERY_DEVICE_NO, SIGNAL_TYPE_BYTE},
+        {SIGNAL_MAX_VOLTAGE_CELL_NO, SIGNAL_TYPE_BYTE},
+        {SIGNAL_CELL_MAX_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_MIN_VOLTAGE_BATTERY_DEVICE_NO, SIGNAL_TYPE_BYTE},
+        {SIGNAL_MIN_VOLTAGE_CELL_NO, SIGNAL_TYPE_BYTE},
+        {SIGNAL_CELL_MIN_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_MAX_TEMPERATURE_DEVICE_NO, SIGNAL_TYPE_BYTE},
+        {SIGNAL_MAX_TEMPERATURE_PROBE_NO, SIGNAL_TYPE_BYTE},
+        {SIGNAL_MAX_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_MIN_TEMPERATURE_DEVICE_NO, SIGNAL_TYPE_BYTE},
+        {SIGNAL_MIN_TEMPERATURE_PROBE_NO, SIGNAL_TYPE_BYTE},
+        {SIGNAL_MIN_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_MAX_ALARM_LEVEL, SIGNAL_TYPE_BYTE},
+        {SIGNAL_ALARM_FLAG, SIGNAL_TYPE_DWORD},
+        {SIGNAL_BATTERY_FAULT_COUNT, SIGNAL_TYPE_BYTE},
+        {SIGNAL_DRIVE_MOTOR_FAULT_COUNT, SIGNAL_TYPE_BYTE},
+        {SIGNAL_ENGINE_FAULT_COUNT, SIGNAL_TYPE_BYTE},
+        {SIGNAL_OTHER_FAULT_COUNT, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CURRENT, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL_COUNT, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL1_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL2_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL3_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL4_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL5_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL6_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL7_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL8_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL9_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL10_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL11_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL12_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL13_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL14_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL15_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_CELL16_VOLTAGE, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_PROBE_COUNT, SIGNAL_TYPE_WORD},
+        {SIGNAL_BATTERY1_PROBE1_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE2_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE3_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE4_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE5_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE6_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE7_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE8_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE9_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE10_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE11_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE12_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE13_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE14_TEMPERATURE, SIGNAL_TYPE_BYTE},
+        {SIGNAL_BATTERY1_PROBE15_TEMPERATURE, SIGNAL_TYPE_BYTE},
+};
+
+const size_t kSignalDefineCount = sizeof(kSignalDefines) / sizeof(kSignalDefines[0]);
+
 RsmsSignalCache &RsmsSignalCache::get_instance() {
     static RsmsSignalCache instance;
     return instance;
@@ -31,11 +123,13 @@ void RsmsSignalCache::stop() {
 }
 
 bool RsmsSignalCache::set_byte(const int &key, const uint8_t &value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     signal_map_[key] = std::to_string(value);
     return true;
 }
 
 bool RsmsSignalCache::get_byte(const int &key, uint8_t &out_value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     auto it = signal_map_.find(key);
     if (it != signal_map_.end()) {
         out_value = static_cast<uint8_t>(std::stoi(it->second));
@@ -45,11 +139,13 @@ bool RsmsSignalCache::get_byte(const int &key, uint8_t &out_value) {
 }
 
 bool RsmsSignalCache::set_word(const int &key, const uint16_t &value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     signal_map_[key] = std::to_string(value);
     return true;
 }
 
 bool RsmsSignalCache::get_word(const int &key, uint16_t &out_value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     auto it = signal_map_.find(key);
     if (it != signal_map_.end()) {
         out_value = static_cast<uint16_t>(std::stoi(it->second));
@@ -59,11 +155,13 @@ bool RsmsSignalCache::get_word(const int &key, uint16_t &out_value) {
 }
 
 bool RsmsSignalCache::set_dword(const int &key, const uint32_t &value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     signal_map_[key] = std::to_string(value);
     return true;
 }
 
 bool RsmsSignalCache::get_dword(const int &key, uint32_t &out_value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     auto it = signal_map_.find(key);
     if (it != signal_map_.end()) {
         out_value = static_cast<uint32_t>(std::stoi(it->second));
@@ -73,11 +171,13 @@ bool RsmsSignalCache::get_dword(const int &key, uint32_t &out_value) {
 }
 
 bool RsmsSignalCache::set_string(const int &key, const std::string &value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     signal_map_[key] = value;
     return true;
 }
 
 bool RsmsSignalCache::get_string(const int &key, std::string &out_value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     auto it = signal_map_.find(key);
     if (it != signal_map_.end()) {
         out_value = it->second;
@@ -87,11 +187,13 @@ bool RsmsSignalCache::get_string(const int &key, std::string &out_value) {
 }
 
 bool RsmsSignalCache::set_boolean(const int &key, const bool &value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     signal_map_[key] = value ? "1" : "0";
     return true;
 }
 
 bool RsmsSignalCache::get_boolean(const int &key, bool &out_value) {
+    std::lock_guard<std::mutex> lock(signal_mutex_);
     auto it = signal_map_.find(key);
     if (it != signal_map_.end()) {
         out_value = it->second == "1";
@@ -100,6 +202,20 @@ bool RsmsSignalCache::get_boolean(const int &key, bool &out_value) {
     return false;
 }
 
+bool RsmsSignalCache::set_value(const int &key, const signal_type_t &type, const uint32_t &value) {
+    switch (type) {
+        case SIGNAL_TYPE_BOOLEAN:
+            return set_boolean(key, value != 0);
+        case SIGNAL_TYPE_BYTE:
+            return set_byte(key, static_cast<uint8_t>(value));
+        case SIGNAL_TYPE_WORD:
+            return set_word(key, static_cast<uint16_t>(value));
+        case SIGNAL_TYPE_DWORD:
+            return set_dword(key, value);
+    }
+    return false;
+}
+
 bool RsmsSignalCache::init() {
     load_file_data();
     return true;
@@ -151,8 +267,11 @@ void RsmsSignalCache::write_file() {
         spdlog::error("创建临时文件[{}]失败", temp_path);
         return;
     }
-    for (const auto &pair: signal_map_) {
-        file << pair.first << "=" << pair.second << std::endl;
+    {
+        std::lock_guard<std::mutex> lock(signal_mutex_);
+        for (const auto &pair: signal_map_) {
+            file << pair.first << "=" << pair.second << '\n';
+        }
     }
     file.close();
     hwyz::Utils::rename_file(temp_path, cache_file_path_);
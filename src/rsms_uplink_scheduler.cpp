@@ -0,0 +1,321 @@
+//
+// Created by hwyz_leo on 2025/9/2.
+//
+#include <algorithm>
+
+#include "spdlog/spdlog.h"
+
+#include "rsms_uplink_scheduler.h"
+#include "mqtt_client.h"
+
+namespace {
+// 各优先级名称
+const char *const kUplinkClassNames[UPLINK_CLASS_COUNT] = {"登录登出", "报警", "实时", "补发"};
+}
+
+RsmsUplinkScheduler &RsmsUplinkScheduler::get_instance() {
+    static RsmsUplinkScheduler instance;
+    return instance;
+}
+
+bool RsmsUplinkScheduler::load_config(const YAML::Node &config) {
+    spdlog::info("加载上行消息调度配置信息");
+    if (config["uplink"]) {
+        if (config["uplink"]["reissue-share"]) {
+            reissue_share_ = config["uplink"]["reissue-share"].as<double>();
+            if (reissue_share_ < 0 || reissue_share_ > 1) {
+                spdlog::error("补发信息保留份额[{}]无效", reissue_share_);
+                return false;
+            }
+        }
+        if (config["uplink"]["queue-depth"]) {
+            max_queue_depth_ = config["uplink"]["queue-depth"].as<size_t>();
+        }
+        if (config["uplink"]["metrics-interval-second"]) {
+            metrics_interval_second_ = config["uplink"]["metrics-interval-second"].as<int>();
+        }
+        if (config["uplink"]["realtime-expiry-second"]) {
+            realtime_expiry_second_ = config["uplink"]["realtime-expiry-second"].as<uint32_t>();
+        }
+        if (config["uplink"]["realtime-max-age-second"]) {
+            realtime_max_age_second_ = config["uplink"]["realtime-max-age-second"].as<int>();
+        }
+    }
+    return true;
+}
+
+bool RsmsUplinkScheduler::start() {
+    if (is_started_) {
+        return true;
+    }
+    spdlog::info("启动上行消息调度");
+    is_started_ = true;
+    MqttClient::get_uplink().set_publish_listener(this);
+    dispatch_thread_ = std::thread(&RsmsUplinkScheduler::dispatch_thread, this);
+    return true;
+}
+
+void RsmsUplinkScheduler::stop() {
+    if (!is_started_) {
+        return;
+    }
+    spdlog::info("停止上行消息调度");
+    is_started_ = false;
+    cv_queue_.notify_all();
+    if (dispatch_thread_.joinable()) {
+        dispatch_thread_.join();
+    }
+    MqttClient::get_uplink().set_publish_listener(nullptr);
+    log_metrics();
+}
+
+void RsmsUplinkScheduler::set_listener(RsmsUplinkListener *listener) {
+    listener_ = listener;
+}
+
+bool RsmsUplinkScheduler::submit(uplink_class_t type, const std::string &topic, std::vector<uint8_t> &&payload,
+                                 uint64_t tag) {
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    std::deque<uplink_message_t> &queue = queues_[type];
+    metrics_[type].enqueued++;
+    if (queue.size() >= max_queue_depth_) {
+        metrics_[type].failed++;
+        lock.unlock();
+        spdlog::warn("{}消息队列已满[{}]，丢弃消息", kUplinkClassNames[type], max_queue_depth_);
+        return false;
+    }
+    queue.push_back({type, topic, std::move(payload), tag, std::chrono::steady_clock::now()});
+    cv_queue_.notify_one();
+    return true;
+}
+
+bool RsmsUplinkScheduler::withdraw(uplink_class_t type, uint64_t tag) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    std::deque<uplink_message_t> &queue = queues_[type];
+    for (auto it = queue.begin(); it != queue.end(); ++it) {
+        if (it->tag == tag) {
+            queue.erase(it);
+            metrics_[type].failed++;
+            return true;
+        }
+    }
+    return false;
+}
+
+uplink_metrics_t RsmsUplinkScheduler::get_metrics(uplink_class_t type) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    uplink_metrics_t metrics = metrics_[type];
+    metrics.depth = queues_[type].size();
+    metrics.avg_wait_ms = metrics.sent > 0 ? total_wait_ms_[type] / static_cast<double>(metrics.sent) : 0;
+    return metrics;
+}
+
+void RsmsUplinkScheduler::on_publish_sent(uint64_t token, int mid, bool is_success) {
+    auto now = std::chrono::steady_clock::now();
+    uplink_inflight_t inflight{};
+    {
+        std::lock_guard<std::mutex> lock(ack_mutex_);
+        auto it = submitted_.find(token);
+        if (it == submitted_.end()) {
+            return;
+        }
+        inflight = it->second;
+        submitted_.erase(it);
+        // 确认与本回调同在网络线程，记录总是早于确认
+        if (is_success) {
+            inflight.publish_time = now;
+            inflight_[mid] = inflight;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        uplink_metrics_t &metrics = metrics_[inflight.type];
+        if (is_success) {
+            double wait_ms = std::chrono::duration<double, std::milli>(now - inflight.enqueue_time).count();
+            metrics.sent++;
+            metrics.max_wait_ms = std::max(metrics.max_wait_ms, wait_ms);
+            total_wait_ms_[inflight.type] += wait_ms;
+        } else {
+            metrics.failed++;
+        }
+    }
+    // 发布队列腾出空间，唤醒因背压等待的发送线程
+    cv_queue_.notify_one();
+    RsmsUplinkListener *listener = listener_;
+    if (listener != nullptr) {
+        listener->on_uplink_sent(inflight.type, inflight.tag, is_success);
+    }
+}
+
+void RsmsUplinkScheduler::on_publish_ack(int mid) {
+    uplink_inflight_t inflight{};
+    {
+        std::lock_guard<std::mutex> lock(ack_mutex_);
+        auto it = inflight_.find(mid);
+        if (it == inflight_.end()) {
+            return;
+        }
+        inflight = it->second;
+        inflight_.erase(it);
+    }
+    RsmsUplinkListener *listener = listener_;
+    if (listener != nullptr) {
+        listener->on_uplink_ack(inflight.type, inflight.tag, std::chrono::steady_clock::now() - inflight.publish_time);
+    }
+}
+
+void RsmsUplinkScheduler::on_connection_lost() {
+    {
+        std::lock_guard<std::mutex> lock(ack_mutex_);
+        inflight_.clear();
+    }
+    RsmsUplinkListener *listener = listener_;
+    if (listener != nullptr) {
+        listener->on_uplink_lost();
+    }
+}
+
+bool RsmsUplinkScheduler::pop_next(bool is_control_only, uplink_message_t &out_message) {
+    int type = -1;
+    if (is_control_only) {
+        type = queues_[UPLINK_CLASS_CONTROL].empty() ? -1 : UPLINK_CLASS_CONTROL;
+    } else if (!queues_[UPLINK_CLASS_REISSUE].empty() && reissue_credit_ >= 1.0) {
+        type = UPLINK_CLASS_REISSUE;
+    } else {
+        for (int i = 0; i < UPLINK_CLASS_COUNT; i++) {
+            if (!queues_[i].empty()) {
+                type = i;
+                break;
+            }
+        }
+    }
+    if (type < 0) {
+        return false;
+    }
+    // 补发队列为空时不累积额度，避免补发恢复后连续插队
+    if (type == UPLINK_CLASS_REISSUE) {
+        reissue_credit_ = std::max(0.0, reissue_credit_ - 1.0);
+    } else if (!queues_[UPLINK_CLASS_REISSUE].empty()) {
+        reissue_credit_ += reissue_share_;
+    }
+    out_message = std::move(queues_[type].front());
+    queues_[type].pop_front();
+    return true;
+}
+
+bool RsmsUplinkScheduler::dispatch(uplink_message_t &message) {
+    uint64_t token;
+    {
+        // 先登记再提交，网络线程可能在提交返回前就回调发布结果
+        std::lock_guard<std::mutex> lock(ack_mutex_);
+        token = ++last_token_;
+        submitted_[token] = {message.type, message.tag, message.enqueue_time, message.enqueue_time};
+    }
+    // 只有实时信息设置过期时间，补发与报警数据必须送达
+    uint32_t expiry_second = message.type == UPLINK_CLASS_REALTIME ? realtime_expiry_second_ : 0;
+    publish_status_t status = MqttClient::get_uplink().publish(message.topic, std::move(message.payload), 1, token,
+                                                                expiry_second);
+    if (status == PUBLISH_QUEUED) {
+        return true;
+    }
+    {
+        std::lock_guard<std::mutex> lock(ack_mutex_);
+        submitted_.erase(token);
+    }
+    if (status == PUBLISH_QUEUE_FULL) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        metrics_[message.type].failed++;
+    }
+    RsmsUplinkListener *listener = listener_;
+    if (listener != nullptr) {
+        listener->on_uplink_sent(message.type, message.tag, false);
+    }
+    return true;
+}
+
+void RsmsUplinkScheduler::expire_realtime(bool is_all) {
+    if (!is_all && realtime_max_age_second_ <= 0) {
+        return;
+    }
+    std::vector<uint64_t> tags;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        std::deque<uplink_message_t> &queue = queues_[UPLINK_CLASS_REALTIME];
+        auto deadline = std::chrono::steady_clock::now() - std::chrono::seconds(realtime_max_age_second_);
+        // 队列按入队时间有序，背压时放回队首也不改变顺序
+        while (!queue.empty() && (is_all || queue.front().enqueue_time < deadline)) {
+            tags.push_back(queue.front().tag);
+            queue.pop_front();
+        }
+        metrics_[UPLINK_CLASS_REALTIME].failed += tags.size();
+    }
+    if (tags.empty()) {
+        return;
+    }
+    spdlog::warn("{}实时信息[{}]条未能及时发送，转为补发", is_all ? "连接断开，" : "排队超时，", tags.size());
+    // 回调时不持有队列锁，监听器可能在持有自身锁时提交消息
+    RsmsUplinkListener *listener = listener_;
+    if (listener != nullptr) {
+        for (uint64_t tag: tags) {
+            listener->on_uplink_sent(UPLINK_CLASS_REALTIME, tag, false);
+        }
+    }
+}
+
+void RsmsUplinkScheduler::log_metrics() {
+    for (int i = 0; i < UPLINK_CLASS_COUNT; i++) {
+        uplink_metrics_t metrics = get_metrics(static_cast<uplink_class_t>(i));
+        spdlog::info("{}消息队列深度[{}]入队[{}]发送[{}]失败[{}]平均排队[{:.1f}]毫秒最大排队[{:.1f}]毫秒",
+                     kUplinkClassNames[i], metrics.depth, metrics.enqueued, metrics.sent, metrics.failed,
+                     metrics.avg_wait_ms, metrics.max_wait_ms);
+    }
+}
+
+void RsmsUplinkScheduler::dispatch_thread() {
+    spdlog::info("初始化上行消息发送线程");
+    auto last_metrics_time = std::chrono::steady_clock::now();
+    while (true) {
+        auto now = std::chrono::steady_clock::now();
+        if (metrics_interval_second_ > 0 && now - last_metrics_time >= std::chrono::seconds(metrics_interval_second_)) {
+            last_metrics_time = now;
+            log_metrics();
+        }
+        bool is_started = is_started_;
+        if (!MqttClient::get_uplink().is_connected()) {
+            // 未连接时实时信息交回转为补发，其他消息保留在队列中，停止时直接退出
+            if (!is_started) {
+                break;
+            }
+            expire_realtime(true);
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            cv_queue_.wait_for(lock, std::chrono::milliseconds(100), [this] { return !is_started_; });
+            continue;
+        }
+        expire_realtime(false);
+        uplink_message_t message;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            if (!pop_next(!is_started, message)) {
+                if (!is_started) {
+                    break;
+                }
+                cv_queue_.wait_for(lock, std::chrono::milliseconds(100));
+                continue;
+            }
+        }
+        if (!dispatch(message)) {
+            // 发布队列已满，消息放回队首保持优先级，等待发布结果腾出空间
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            if (message.type == UPLINK_CLASS_REISSUE) {
+                reissue_credit_ += 1.0;
+            } else if (!queues_[UPLINK_CLASS_REISSUE].empty()) {
+                reissue_credit_ = std::max(0.0, reissue_credit_ - reissue_share_);
+            }
+            queues_[message.type].push_front(std::move(message));
+            cv_queue_.wait_for(lock, std::chrono::milliseconds(100));
+        }
+    }
+}
@@ -0,0 +1,122 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <cstdio>
+
+#include "yaml-cpp/yaml.h"
+
+#include "can_ingest.h"
+#include "rsms_signal_cache.h"
+
+namespace {
+// 覆盖Intel与Motorola字节序、跨字节、非字节对齐、有符号与精度偏移量
+const char *const kSignalsConfig = R"(
+can:
+  signals:
+    - {id: "0x100", signal: 104, start-bit: 8, length: 16, factor: 0.1}
+    - {id: "0x100", signal: 106, start-bit: 7, length: 16, byte-order: motorola}
+    - {id: "0x100", signal: 108, start-bit: 35, length: 4, byte-order: motorola}
+    - {id: "0x101", signal: 113, start-bit: 4, length: 12, byte-order: motorola}
+    - {id: "0x101", signal: 205, start-bit: 32, length: 8, signed: true, offset: 100}
+    - {id: "0x101", signal: 202, start-bit: 40, length: 8, signed: true}
+    - {id: "0x101", signal: 203, start-bit: 48, length: 16, factor: 2}
+    - {id: "0x102", signal: 105, start-bit: 0, length: 32}
+)";
+
+uint16_t get_word(int key) {
+    uint16_t value = 0;
+    assert(RsmsSignalCache::get_instance().get_word(key, value));
+    return value;
+}
+
+uint8_t get_byte(int key) {
+    uint8_t value = 0;
+    assert(RsmsSignalCache::get_instance().get_byte(key, value));
+    return value;
+}
+
+bool load_signal(const char *signal) {
+    return CanIngest::get_instance().load_config(YAML::Load(std::string("can:\n  signals:\n    - ") + signal));
+}
+
+void test_decode() {
+    CanIngest &ingest = CanIngest::get_instance();
+    assert(ingest.load_config(YAML::Load(kSignalsConfig)));
+    const uint8_t frame_100[8] = {0x12, 0x34, 0x12, 0x00, 0xA5, 0x00, 0x00, 0x00};
+    assert(ingest.decode_frame(0x100, frame_100, 8));
+    // Intel：字节1为低字节，0x1234*0.1
+    assert(get_word(SIGNAL_SPEED) == 466);
+    // Motorola：起始位为字节0最高位，字节0为高字节
+    assert(get_word(SIGNAL_TOTAL_VOLTAGE) == 0x1234);
+    // Motorola非字节对齐：字节4的低4位
+    assert(get_byte(SIGNAL_SOC) == 0x05);
+
+    const uint8_t frame_101[8] = {0x15, 0xA3, 0x00, 0x00, 0xF6, 0x80, 0x50, 0xC3};
+    assert(ingest.decode_frame(0x101, frame_101, 8));
+    // Motorola跨字节：字节0低5位接字节1高7位
+    assert(get_word(SIGNAL_INSULATION_RESISTANCE) == (((0x15 & 0x1F) << 7) | (0xA3 >> 1)));
+    // 有符号-10加偏移量100
+    assert(get_byte(SIGNAL_DM1_TEMPERATURE) == 90);
+    // 有符号负值限制为0
+    assert(get_byte(SIGNAL_DM1_CONTROLLER_TEMPERATURE) == 0);
+    // 超出字长的物理值限制为最大值
+    assert(get_word(SIGNAL_DM1_SPEED) == 65535);
+
+    // 不足8字节的报文按0补齐
+    const uint8_t frame_102[4] = {0x78, 0x56, 0x34, 0x12};
+    assert(ingest.decode_frame(0x102, frame_102, 4));
+    uint32_t odometer = 0;
+    assert(RsmsSignalCache::get_instance().get_dword(SIGNAL_TOTAL_ODOMETER, odometer));
+    assert(odometer == 0x12345678);
+
+    assert(!ingest.decode_frame(0x7FF, frame_100, 8));
+}
+
+void test_extended_id() {
+    CanIngest &ingest = CanIngest::get_instance();
+    assert(ingest.load_config(YAML::Load(R"(
+can:
+  signals:
+    - {id: "0x100", signal: 104, start-bit: 0, length: 16}
+    - {id: "0x18FEF100", signal: 106, start-bit: 0, length: 16}
+)")));
+    RsmsSignalCache::get_instance().set_word(SIGNAL_SPEED, 1);
+    const uint8_t frame[8] = {0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    // 低11位相同的扩展帧不按标准帧解析
+    assert(!ingest.decode_frame(kCanExtendedFlag | 0x100, frame, 8));
+    assert(get_word(SIGNAL_SPEED) == 1);
+    assert(ingest.decode_frame(0x100, frame, 8));
+    assert(get_word(SIGNAL_SPEED) == 0x1234);
+    // 超过11位的ID按扩展帧解析
+    assert(!ingest.decode_frame(0x18FEF100, frame, 8));
+    assert(ingest.decode_frame(kCanExtendedFlag | 0x18FEF100, frame, 8));
+    assert(get_word(SIGNAL_TOTAL_VOLTAGE) == 0x1234);
+    // 超过29位的ID无效
+    assert(!load_signal("{id: \"0x20000000\", signal: 104, start-bit: 0, length: 16}"));
+}
+
+void test_invalid_signals() {
+    assert(load_signal("{id: \"0x200\", signal: 104, start-bit: 0, length: 16}"));
+    // 缺少必填项、信号不在定义表中、长度或起始位无效
+    assert(!load_signal("{id: \"0x200\", signal: 104, start-bit: 0}"));
+    assert(!load_signal("{id: \"0x200\", signal: 9999, start-bit: 0, length: 8}"));
+    assert(!load_signal("{id: \"0x200\", signal: 104, start-bit: 0, length: 0}"));
+    assert(!load_signal("{id: \"0x200\", signal: 104, start-bit: 0, length: 33}"));
+    assert(!load_signal("{id: \"0x200\", signal: 104, start-bit: 64, length: 8}"));
+    // 超出报文范围：Intel从起始位向高位，Motorola从起始位向后续字节
+    assert(!load_signal("{id: \"0x200\", signal: 104, start-bit: 60, length: 8}"));
+    assert(!load_signal("{id: \"0x200\", signal: 104, start-bit: 59, length: 8, byte-order: motorola}"));
+    assert(load_signal("{id: \"0x200\", signal: 104, start-bit: 63, length: 8, byte-order: motorola}"));
+}
+}
+
+int main() {
+    test_decode();
+    test_extended_id();
+    test_invalid_signals();
+    std::printf("can_ingest_test passed\n");
+    return 0;
+}
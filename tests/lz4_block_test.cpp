@@ -0,0 +1,111 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "lz4_block.h"
+
+namespace {
+// 压缩后解压，校验与原数据一致，返回压缩后长度
+size_t round_trip(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> compressed;
+    lz4_compress_block(data.data(), data.size(), compressed);
+    // 解压结果追加在已有内容之后
+    std::vector<uint8_t> decompressed = {0xAA, 0xBB};
+    assert(lz4_decompress_block(compressed.data(), compressed.size(), data.size(), decompressed));
+    assert(decompressed.size() == data.size() + 2 && decompressed[0] == 0xAA && decompressed[1] == 0xBB);
+    assert(std::equal(data.begin(), data.end(), decompressed.begin() + 2));
+    return compressed.size();
+}
+
+std::vector<uint8_t> random_bytes(size_t length) {
+    std::vector<uint8_t> data(length);
+    for (auto &byte: data) {
+        byte = static_cast<uint8_t>(std::rand());
+    }
+    return data;
+}
+
+bool decompress(const std::vector<uint8_t> &compressed, size_t raw_length) {
+    std::vector<uint8_t> out;
+    return lz4_decompress_block(compressed.data(), compressed.size(), raw_length, out);
+}
+
+void test_round_trip() {
+    std::srand(1);
+    // 空数据与不足一次匹配的短数据只有字面量
+    assert(round_trip(std::vector<uint8_t>()) == 1);
+    assert(round_trip(std::vector<uint8_t>(12, 'a')) == 13);
+    // 重复数据，含超过15与255的字面量及匹配长度、与写入位置重叠的匹配
+    assert(round_trip(std::vector<uint8_t>(100000, 'a')) < 500);
+    std::string text;
+    for (int i = 0; i < 2000; i++) {
+        text += "vin=LHWYZ0000000" + std::to_string(i % 10) + ",speed=" + std::to_string(i % 120) + ";";
+    }
+    assert(round_trip(std::vector<uint8_t>(text.begin(), text.end())) < text.size() / 4);
+    // 随机数据不可压缩，只增加少量长度
+    std::vector<uint8_t> noise = random_bytes(5000);
+    assert(round_trip(noise) <= noise.size() + noise.size() / 255 + 16);
+    // 随机数据与重复数据交替，匹配距离接近上限
+    std::vector<uint8_t> mixed = random_bytes(70000);
+    mixed.insert(mixed.end(), mixed.begin(), mixed.begin() + 1000);
+    mixed.insert(mixed.end(), 300, 'z');
+    round_trip(mixed);
+    for (size_t length = 0; length < 64; length++) {
+        round_trip(random_bytes(length));
+        round_trip(std::vector<uint8_t>(length, static_cast<uint8_t>(length)));
+    }
+}
+
+void test_standard_block() {
+    // 标准LZ4块：字面量"abc"，距离3长度12的匹配，最后5字节字面量
+    std::vector<uint8_t> block = {0x38, 'a', 'b', 'c', 0x03, 0x00, 0x50, 'a', 'b', 'c', 'a', 'b'};
+    std::vector<uint8_t> out;
+    assert(lz4_decompress_block(block.data(), block.size(), 20, out));
+    assert(std::string(out.begin(), out.end()) == "abcabcabcabcabcabcab");
+}
+
+void test_malformed() {
+    std::vector<uint8_t> data(1000, 'x');
+    std::vector<uint8_t> compressed;
+    lz4_compress_block(data.data(), data.size(), compressed);
+    assert(decompress(compressed, data.size()));
+    // 解压后长度不符
+    assert(!decompress(compressed, data.size() - 1));
+    assert(!decompress(compressed, data.size() + 1));
+    // 截断的数据
+    for (size_t length = 1; length < compressed.size(); length++) {
+        std::vector<uint8_t> truncated(compressed.begin(), compressed.begin() + length);
+        assert(!decompress(truncated, data.size()));
+    }
+    // 字面量超出数据
+    assert(!decompress({0x50, 'a', 'b'}, 5));
+    // 匹配距离为0或超出已解压数据
+    assert(!decompress({0x10, 'a', 0x00, 0x00, 0x00}, 5));
+    assert(!decompress({0x10, 'a', 0x02, 0x00, 0x00}, 5));
+    // 长度扩展字节缺失
+    assert(!decompress({0xF0}, 15));
+    assert(!decompress({0x1F, 'a', 0x01, 0x00}, 100));
+    // 随机数据不会越界访问
+    std::srand(2);
+    for (int i = 0; i < 10000; i++) {
+        std::vector<uint8_t> garbage = random_bytes(static_cast<size_t>(std::rand() % 64));
+        decompress(garbage, static_cast<size_t>(std::rand() % 256));
+    }
+}
+}
+
+int main() {
+    test_round_trip();
+    test_standard_block();
+    test_malformed();
+    std::printf("lz4_block_test passed\n");
+    return 0;
+}
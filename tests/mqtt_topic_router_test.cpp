@@ -0,0 +1,106 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <cstdio>
+#include <string>
+
+#include "mqtt_topic_router.h"
+
+namespace {
+// 记录名称的处理器
+class NamedHandler : public MqttMessageHandler {
+public:
+    explicit NamedHandler(const char *name) : name(name) {}
+
+    void handle(std::string) override {}
+
+    const char *name;
+};
+
+void test_exact_and_overwrite() {
+    MqttTopicRouter router;
+    NamedHandler first("first");
+    NamedHandler second("second");
+    assert(router.add("RSMS/MCU_DATA", first));
+    assert(router.route("RSMS/MCU_DATA") == &first);
+    assert(router.route("RSMS/MCU_DATA/V2") == nullptr);
+    assert(router.route("RSMS/MCU") == nullptr);
+    // 重复添加覆盖原处理器，数量不变
+    assert(router.add("RSMS/MCU_DATA", second));
+    assert(router.route("RSMS/MCU_DATA") == &second);
+    assert(router.size() == 1);
+    assert(router.remove("RSMS/MCU_DATA"));
+    assert(!router.remove("RSMS/MCU_DATA"));
+    assert(router.route("RSMS/MCU_DATA") == nullptr);
+    assert(router.route(nullptr) == nullptr);
+}
+
+void test_wildcards() {
+    MqttTopicRouter router;
+    NamedHandler plus("plus");
+    NamedHandler hash("hash");
+    NamedHandler exact("exact");
+    NamedHandler all("all");
+    assert(router.add("RSMS/+/V2", plus));
+    assert(router.add("RSMS/#", hash));
+    assert(router.add("RSMS/MCU_DATA/V2", exact));
+    assert(router.size() == 3);
+    // 精确匹配 > 单层通配符 > 多层通配符
+    assert(router.route("RSMS/MCU_DATA/V2") == &exact);
+    assert(router.route("RSMS/CAN/V2") == &plus);
+    assert(router.route("RSMS/CAN/V2/DELTA") == &hash);
+    assert(router.route("RSMS/CAN") == &hash);
+    // a/#同样匹配a
+    assert(router.route("RSMS") == &hash);
+    assert(router.route("GLOBAL/TSP_CONNECT") == nullptr);
+    // 单层通配符匹配空层
+    assert(router.route("RSMS//V2") == &plus);
+    assert(router.add("#", all));
+    assert(router.route("GLOBAL/TSP_CONNECT") == &all);
+    assert(router.remove("RSMS/+/V2"));
+    assert(router.route("RSMS/CAN/V2") == &hash);
+    assert(!router.remove("RSMS/+/V2"));
+    router.clear();
+    assert(router.size() == 0);
+    assert(router.route("RSMS/CAN/V2") == nullptr);
+}
+
+void test_system_topics() {
+    MqttTopicRouter router;
+    NamedHandler all("all");
+    NamedHandler plus("plus");
+    NamedHandler sys("sys");
+    assert(router.add("#", all));
+    assert(router.add("+/monitor", plus));
+    // 以$开头的系统主题不匹配首层通配符，只能显式订阅
+    assert(router.route("$SYS/broker/uptime") == nullptr);
+    assert(router.route("$SYS/monitor") == nullptr);
+    assert(router.route("app/monitor") == &plus);
+    assert(router.add("$SYS/#", sys));
+    assert(router.route("$SYS/broker/uptime") == &sys);
+    // 非首层的$没有特殊含义
+    assert(router.route("app/$state") == &all);
+}
+
+void test_invalid_filters() {
+    MqttTopicRouter router;
+    NamedHandler handler("handler");
+    assert(!router.add("", handler));
+    assert(!router.add("RSMS/#/V2", handler));
+    assert(!router.add("RSMS/MCU+", handler));
+    assert(!router.add("RSMS/#DATA", handler));
+    assert(router.size() == 0);
+}
+}
+
+int main() {
+    test_exact_and_overwrite();
+    test_wildcards();
+    test_system_topics();
+    test_invalid_filters();
+    std::printf("mqtt_topic_router_test passed\n");
+    return 0;
+}
@@ -0,0 +1,99 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+#include "rsms_frame_ring.h"
+
+namespace {
+std::string make_frame(uint64_t sequence, size_t length) {
+    std::string frame = "frame-" + std::to_string(sequence);
+    frame.resize(std::max(length, frame.size()), static_cast<char>('a' + sequence % 26));
+    return frame;
+}
+
+uint64_t push_frame(RsmsFrameRing &ring, const std::string &frame) {
+    return ring.push(reinterpret_cast<const uint8_t *>(frame.data()), frame.size());
+}
+
+// 读取帧并返回内容，帧不在缓冲中时为空
+std::string get_frame(const RsmsFrameRing &ring, uint64_t sequence) {
+    const uint8_t *data = nullptr;
+    size_t length = 0;
+    if (!ring.get(sequence, data, length)) {
+        return std::string();
+    }
+    return std::string(reinterpret_cast<const char *>(data), length);
+}
+
+void test_empty() {
+    RsmsFrameRing ring(4);
+    assert(ring.front_sequence() == 1 && ring.end_sequence() == 1);
+    assert(!ring.is_full());
+    assert(get_frame(ring, 0).empty() && get_frame(ring, 1).empty());
+}
+
+void test_wraparound() {
+    RsmsFrameRing ring(4);
+    ring.reserve(32);
+    for (uint64_t sequence = 1; sequence <= 3; sequence++) {
+        assert(push_frame(ring, make_frame(sequence, 20)) == sequence);
+    }
+    assert(ring.front_sequence() == 1 && ring.end_sequence() == 4 && !ring.is_full());
+    assert(push_frame(ring, make_frame(4, 20)) == 4);
+    assert(ring.is_full());
+    // 已满后追加覆盖最早的帧
+    for (uint64_t sequence = 5; sequence <= 10; sequence++) {
+        assert(push_frame(ring, make_frame(sequence, sequence)) == sequence);
+        assert(ring.front_sequence() == sequence - 3 && ring.end_sequence() == sequence + 1);
+        assert(ring.is_full());
+    }
+    assert(get_frame(ring, 6).empty() && get_frame(ring, 11).empty());
+    for (uint64_t sequence = 7; sequence <= 10; sequence++) {
+        assert(get_frame(ring, sequence) == make_frame(sequence, sequence));
+    }
+}
+
+void test_grow() {
+    RsmsFrameRing ring(3);
+    ring.reserve(16);
+    push_frame(ring, make_frame(1, 16));
+    push_frame(ring, make_frame(2, 8));
+    // 超过槽位大小的帧重新分配槽位，已缓存的帧保留
+    push_frame(ring, make_frame(3, 100));
+    assert(get_frame(ring, 1) == make_frame(1, 16));
+    assert(get_frame(ring, 2) == make_frame(2, 8));
+    assert(get_frame(ring, 3) == make_frame(3, 100));
+    // 更小的槽位大小不缩小已分配的槽位
+    ring.reserve(8);
+    push_frame(ring, make_frame(4, 100));
+    assert(get_frame(ring, 1).empty());
+    assert(get_frame(ring, 2) == make_frame(2, 8));
+    assert(get_frame(ring, 4) == make_frame(4, 100));
+}
+
+void test_single_slot() {
+    // 槽位数量为0时按1处理
+    RsmsFrameRing ring(0);
+    push_frame(ring, make_frame(1, 10));
+    assert(ring.is_full());
+    push_frame(ring, make_frame(2, 10));
+    assert(ring.front_sequence() == 2 && ring.end_sequence() == 3);
+    assert(get_frame(ring, 1).empty());
+    assert(get_frame(ring, 2) == make_frame(2, 10));
+}
+}
+
+int main() {
+    test_empty();
+    test_wraparound();
+    test_grow();
+    test_single_slot();
+    std::printf("rsms_frame_ring_test passed\n");
+    return 0;
+}
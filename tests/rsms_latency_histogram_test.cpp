@@ -0,0 +1,94 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <cstdio>
+#include <limits>
+
+#include "rsms_latency_histogram.h"
+
+namespace {
+void test_empty() {
+    RsmsLatencyHistogram histogram;
+    assert(histogram.count() == 0);
+    assert(histogram.min() == 0 && histogram.max() == 0);
+    assert(histogram.mean() == 0);
+    assert(histogram.percentile(0.5) == 0 && histogram.percentile(1) == 0);
+}
+
+void test_small_values() {
+    // 小于8的取值各占一个分桶，分位值精确
+    RsmsLatencyHistogram histogram;
+    for (uint64_t value = 0; value < 8; value++) {
+        histogram.record(value);
+    }
+    assert(histogram.count() == 8);
+    assert(histogram.min() == 0 && histogram.max() == 7);
+    assert(histogram.mean() == 3.5);
+    assert(histogram.percentile(0) == 0);
+    assert(histogram.percentile(0.5) == 3);
+    assert(histogram.percentile(1) == 7);
+    // 分位超出范围时取边界
+    assert(histogram.percentile(-1) == 0);
+    assert(histogram.percentile(2) == 7);
+}
+
+void test_relative_error() {
+    // 任意取值的分位值不小于取值，相对误差不超过12.5%
+    for (uint64_t value = 1; value < 1000000; value = value * 3 / 2 + 1) {
+        for (uint64_t delta = 0; delta < 3; delta++) {
+            RsmsLatencyHistogram histogram;
+            histogram.record(0);
+            histogram.record(value + delta);
+            histogram.record(std::numeric_limits<uint64_t>::max());
+            uint64_t median = histogram.percentile(0.5);
+            assert(median >= value + delta);
+            assert(median - (value + delta) <= (value + delta) / 8);
+        }
+    }
+}
+
+void test_percentile() {
+    RsmsLatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 1000; value++) {
+        histogram.record(value);
+    }
+    assert(histogram.count() == 1000);
+    assert(histogram.min() == 1 && histogram.max() == 1000);
+    assert(histogram.mean() == 500.5);
+    uint64_t p50 = histogram.percentile(0.5);
+    uint64_t p99 = histogram.percentile(0.99);
+    assert(p50 >= 500 && p50 <= 500 * 9 / 8);
+    assert(p99 >= 990 && p99 <= 1000);
+    // 分位值不超过最大值
+    assert(histogram.percentile(1) == 1000);
+}
+
+void test_extremes_and_reset() {
+    RsmsLatencyHistogram histogram;
+    const uint64_t kMax = std::numeric_limits<uint64_t>::max();
+    histogram.record(kMax);
+    histogram.record(kMax - 1);
+    assert(histogram.min() == kMax - 1 && histogram.max() == kMax);
+    assert(histogram.percentile(0.5) == kMax);
+    histogram.reset();
+    assert(histogram.count() == 0 && histogram.min() == 0 && histogram.max() == 0);
+    assert(histogram.percentile(0.5) == 0);
+    // 清空后最小值从新的记录开始
+    histogram.record(42);
+    assert(histogram.min() == 42 && histogram.max() == 42);
+    assert(histogram.percentile(0.5) == 42);
+}
+}
+
+int main() {
+    test_empty();
+    test_small_values();
+    test_relative_error();
+    test_percentile();
+    test_extremes_and_reset();
+    std::printf("rsms_latency_histogram_test passed\n");
+    return 0;
+}
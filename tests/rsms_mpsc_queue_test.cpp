@@ -0,0 +1,100 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "rsms_mpsc_queue.h"
+
+namespace {
+void test_order() {
+    RsmsMpscQueue<int> queue;
+    std::vector<int> values;
+    assert(queue.empty());
+    assert(queue.pop_all(values) == 0 && values.empty());
+    queue.push(1);
+    queue.push(2);
+    queue.push_batch(std::vector<int>{3, 4, 5});
+    queue.push_batch(std::vector<int>());
+    queue.push(6);
+    assert(!queue.empty());
+    // 出队结果追加在已有内容之后，保持入队顺序
+    values.push_back(0);
+    assert(queue.pop_all(values) == 6);
+    assert(values == std::vector<int>({0, 1, 2, 3, 4, 5, 6}));
+    assert(queue.empty());
+    queue.push(7);
+    values.clear();
+    assert(queue.pop_all(values) == 1 && values == std::vector<int>({7}));
+}
+
+void test_move_only() {
+    RsmsMpscQueue<std::unique_ptr<int>> queue;
+    queue.push(std::unique_ptr<int>(new int(1)));
+    std::vector<std::unique_ptr<int>> batch;
+    batch.emplace_back(new int(2));
+    batch.emplace_back(new int(3));
+    queue.push_batch(std::move(batch));
+    std::vector<std::unique_ptr<int>> values;
+    assert(queue.pop_all(values) == 3);
+    assert(*values[0] == 1 && *values[1] == 2 && *values[2] == 3);
+    // 未出队的节点由析构函数释放
+    queue.push(std::unique_ptr<int>(new int(4)));
+}
+
+void test_concurrent() {
+    const int kProducerCount = 4;
+    const int kValueCount = 100000;
+    RsmsMpscQueue<std::pair<int, int>> queue;
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < kProducerCount; producer++) {
+        producers.emplace_back([&queue, producer, kValueCount]() {
+            for (int i = 0; i < kValueCount;) {
+                // 单条与批量交替入队
+                if (i % 7 == 0) {
+                    std::vector<std::pair<int, int>> batch;
+                    for (int j = 0; j < 5 && i < kValueCount; j++, i++) {
+                        batch.emplace_back(producer, i);
+                    }
+                    queue.push_batch(std::move(batch));
+                } else {
+                    queue.push(std::make_pair(producer, i++));
+                }
+            }
+        });
+    }
+    // 每个生产者的元素按入队顺序出队，不丢失不重复
+    std::vector<int> next(kProducerCount, 0);
+    size_t total = 0;
+    std::vector<std::pair<int, int>> values;
+    while (total < static_cast<size_t>(kProducerCount * kValueCount)) {
+        values.clear();
+        total += queue.pop_all(values);
+        for (const auto &value: values) {
+            assert(value.second == next[value.first]);
+            next[value.first]++;
+        }
+    }
+    for (auto &producer: producers) {
+        producer.join();
+    }
+    assert(queue.empty());
+    for (int producer = 0; producer < kProducerCount; producer++) {
+        assert(next[producer] == kValueCount);
+    }
+}
+}
+
+int main() {
+    test_order();
+    test_move_only();
+    test_concurrent();
+    std::printf("rsms_mpsc_queue_test passed\n");
+    return 0;
+}
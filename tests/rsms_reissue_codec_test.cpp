@@ -0,0 +1,196 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "rsms_reissue_codec.h"
+
+namespace {
+/**
+ * 内存补发数据存储，超过容量时淘汰最早的记录
+ */
+class MemoryStore : public RsmsReissueStore {
+public:
+    explicit MemoryStore(size_t capacity) : capacity_(capacity) {
+    }
+
+    bool open() override {
+        return true;
+    }
+
+    void close() override {
+    }
+
+    bool append(const uint8_t *data, size_t length) override {
+        records_.emplace_back(data, data + length);
+        if (records_.size() > capacity_) {
+            records_.pop_front();
+            head_sequence_++;
+        }
+        return true;
+    }
+
+    size_t peek(uint64_t sequence, size_t max_count, std::vector<std::vector<uint8_t>> &out_frames,
+                uint64_t &out_sequence) override {
+        sequence = std::max(sequence, head_sequence_);
+        out_sequence = sequence;
+        size_t count = 0;
+        for (uint64_t i = sequence - head_sequence_; i < records_.size() && count < max_count; i++, count++) {
+            out_frames.push_back(records_[i]);
+        }
+        return count;
+    }
+
+    void consume(uint64_t end_sequence) override {
+        while (head_sequence_ < end_sequence && !records_.empty()) {
+            records_.pop_front();
+            head_sequence_++;
+        }
+    }
+
+    uint64_t head_sequence() override {
+        return head_sequence_;
+    }
+
+    bool sync() override {
+        return true;
+    }
+
+    size_t size() override {
+        return records_.size();
+    }
+
+private:
+    // 最多保存的记录数量
+    size_t capacity_;
+    // 未消费的记录
+    std::deque<std::vector<uint8_t>> records_;
+    // 最早未消费记录的序号
+    uint64_t head_sequence_ = 1;
+};
+
+// 模拟实时数据单元：年份开头，只有时间与少量信号随序号变化
+std::vector<uint8_t> make_frame(uint64_t sequence) {
+    std::vector<uint8_t> frame(64, 0x11);
+    frame[0] = 25;
+    frame[5] = static_cast<uint8_t>(sequence % 60);
+    frame[20] = static_cast<uint8_t>(sequence * 7);
+    frame[21] = static_cast<uint8_t>(sequence >> 8);
+    frame[63] = static_cast<uint8_t>(sequence % 3);
+    return frame;
+}
+
+void append_frames(RsmsReissueCodec &codec, uint64_t first, uint64_t last) {
+    for (uint64_t sequence = first; sequence <= last; sequence++) {
+        std::vector<uint8_t> frame = make_frame(sequence);
+        assert(codec.append(frame.data(), frame.size()));
+    }
+}
+
+// 从指定序号读取并校验每条数据与其序号对应，返回读取数量
+size_t check_frames(RsmsReissueCodec &codec, uint64_t sequence, size_t max_count, uint64_t expected_first) {
+    std::vector<std::vector<uint8_t>> frames;
+    uint64_t first = 0;
+    size_t count = codec.peek(sequence, max_count, frames, first);
+    assert(count == frames.size());
+    assert(count == 0 || first == expected_first);
+    for (size_t i = 0; i < count; i++) {
+        assert(frames[i] == make_frame(first + i));
+    }
+    return count;
+}
+
+void test_encode_decode() {
+    std::vector<uint8_t> previous = make_frame(1);
+    std::vector<uint8_t> current = make_frame(2);
+    std::vector<uint8_t> record;
+    std::vector<uint8_t> decoded;
+    // 没有上一条数据时编码为关键帧
+    assert(!RsmsReissueCodec::encode(std::vector<uint8_t>(), current.data(), current.size(), record));
+    assert(RsmsReissueCodec::is_keyframe(record) && record.size() == current.size() + 1);
+    assert(RsmsReissueCodec::decode(nullptr, record, decoded) && decoded == current);
+    // 相邻数据编码为差分帧，只保存不同的字节
+    assert(RsmsReissueCodec::encode(previous, current.data(), current.size(), record));
+    assert(!RsmsReissueCodec::is_keyframe(record) && record.size() < current.size() / 4);
+    assert(RsmsReissueCodec::decode(&previous, record, decoded) && decoded == current);
+    // 差分帧缺少上一条数据时无法解码
+    assert(!RsmsReissueCodec::decode(nullptr, record, decoded));
+    // 相同数据的差分帧只有记录类型
+    assert(RsmsReissueCodec::encode(current, current.data(), current.size(), record) && record.size() == 1);
+    assert(RsmsReissueCodec::decode(&current, record, decoded) && decoded == current);
+    // 长度变化或编码后不更小时编码为关键帧
+    std::vector<uint8_t> shorter(current.begin(), current.end() - 1);
+    assert(!RsmsReissueCodec::encode(previous, shorter.data(), shorter.size(), record));
+    std::vector<uint8_t> inverted(previous.size());
+    for (size_t i = 0; i < previous.size(); i++) {
+        inverted[i] = static_cast<uint8_t>(~previous[i]);
+    }
+    assert(!RsmsReissueCodec::encode(previous, inverted.data(), inverted.size(), record));
+    assert(RsmsReissueCodec::decode(nullptr, record, decoded) && decoded == inverted);
+    // 旧版本未编码的数据按原样读取
+    assert(RsmsReissueCodec::is_keyframe(current));
+    assert(RsmsReissueCodec::decode(nullptr, current, decoded) && decoded == current);
+    // 越界的差分帧解码失败
+    std::vector<uint8_t> corrupt = {0xF1, 0x3F, 0x05, 1, 2, 3, 4, 5};
+    assert(!RsmsReissueCodec::decode(&previous, corrupt, decoded));
+}
+
+void test_peek_and_consume() {
+    MemoryStore *store = new MemoryStore(1000);
+    RsmsReissueCodec codec(std::unique_ptr<RsmsReissueStore>(store), 10);
+    assert(codec.open());
+    append_frames(codec, 1, 100);
+    assert(codec.head_sequence() == 1 && codec.size() == 100);
+    assert(codec.get_compression_ratio() > 4);
+    assert(check_frames(codec, 0, 1000, 1) == 100);
+    // 顺序读取与任意位置读取
+    for (uint64_t sequence = 1; sequence <= 100; sequence += 9) {
+        assert(check_frames(codec, sequence, 5, sequence) == std::min<uint64_t>(5, 101 - sequence));
+    }
+    assert(check_frames(codec, 101, 5, 101) == 0);
+    // 关键帧为第1、11、21、31...条，底层存储只消费到不晚于结束序号的关键帧
+    codec.consume(35);
+    assert(codec.head_sequence() == 35 && codec.size() == 66);
+    assert(store->head_sequence() == 31);
+    assert(check_frames(codec, 0, 1000, 35) == 66);
+    assert(check_frames(codec, 37, 3, 37) == 3);
+    codec.close();
+}
+
+void test_evicted_keyframe() {
+    // 底层存储只保留25条，第1条关键帧被淘汰后第6~10条差分帧无法解码
+    MemoryStore *store = new MemoryStore(25);
+    RsmsReissueCodec codec(std::unique_ptr<RsmsReissueStore>(store), 10);
+    assert(codec.open());
+    append_frames(codec, 1, 30);
+    assert(store->head_sequence() == 6);
+    assert(check_frames(codec, 0, 1000, 11) == 20);
+    // 跳过的数据视为已消费，补发不会停滞
+    assert(codec.head_sequence() == 11 && codec.size() == 20);
+    assert(check_frames(codec, 7, 3, 11) == 3);
+    // 继续写入后数据仍可解码
+    append_frames(codec, 31, 33);
+    assert(check_frames(codec, 11, 1000, 11) == 23);
+    // 第11条关键帧也被淘汰后跳到第21条关键帧
+    append_frames(codec, 34, 40);
+    assert(store->head_sequence() == 16);
+    assert(check_frames(codec, 0, 1000, 21) == 20);
+    assert(codec.head_sequence() == 21 && codec.size() == 20);
+    codec.close();
+}
+}
+
+int main() {
+    test_encode_decode();
+    test_peek_and_consume();
+    test_evicted_keyframe();
+    std::printf("rsms_reissue_codec_test passed\n");
+    return 0;
+}
@@ -0,0 +1,103 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+#include "rsms_reissue_envelope.h"
+
+namespace {
+// 模拟国标报文：相邻报文只有少量字节不同
+std::vector<std::vector<uint8_t>> make_frames(size_t count) {
+    std::vector<std::vector<uint8_t>> frames;
+    for (size_t i = 0; i < count; i++) {
+        std::vector<uint8_t> frame(200 + i % 3, 0x23);
+        frame[2] = 0x02;
+        frame[30] = static_cast<uint8_t>(i);
+        frame[31] = static_cast<uint8_t>(i * 13);
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+bool unpack(const std::vector<uint8_t> &envelope, std::vector<std::vector<uint8_t>> &frames) {
+    return unpack_reissue_envelope(envelope.data(), envelope.size(), frames);
+}
+
+void test_pack_unpack() {
+    std::vector<std::vector<uint8_t>> frames = make_frames(50);
+    std::vector<uint8_t> plain;
+    pack_reissue_envelope(frames, ENVELOPE_COMPRESSION_NONE, plain);
+    assert(plain.size() > kEnvelopeHeaderLength);
+    assert(plain[0] == 0x52 && plain[1] == 0x42 && plain[2] == 0x01 && plain[3] == ENVELOPE_COMPRESSION_NONE);
+    assert(plain[4] == 0 && plain[5] == 50);
+    std::vector<std::vector<uint8_t>> unpacked;
+    assert(unpack(plain, unpacked) && unpacked == frames);
+    std::vector<uint8_t> compressed;
+    pack_reissue_envelope(frames, ENVELOPE_COMPRESSION_LZ4, compressed);
+    assert(compressed[3] == ENVELOPE_COMPRESSION_LZ4 && compressed.size() < plain.size() / 4);
+    // 解包结果追加在已有内容之后
+    assert(unpack(compressed, unpacked) && unpacked.size() == 100);
+    assert(std::vector<std::vector<uint8_t>>(unpacked.begin() + 50, unpacked.end()) == frames);
+    // 空信封
+    std::vector<uint8_t> empty;
+    pack_reissue_envelope(std::vector<std::vector<uint8_t>>(), ENVELOPE_COMPRESSION_LZ4, empty);
+    unpacked.clear();
+    assert(unpack(empty, unpacked) && unpacked.empty());
+}
+
+void test_incompressible() {
+    // 压缩后不更小时不压缩
+    std::vector<std::vector<uint8_t>> frames(1, std::vector<uint8_t>(16));
+    for (size_t i = 0; i < frames[0].size(); i++) {
+        frames[0][i] = static_cast<uint8_t>(i * 37);
+    }
+    std::vector<uint8_t> envelope;
+    pack_reissue_envelope(frames, ENVELOPE_COMPRESSION_LZ4, envelope);
+    assert(envelope[3] == ENVELOPE_COMPRESSION_NONE && envelope.size() == kEnvelopeHeaderLength + 4 + 16);
+    std::vector<std::vector<uint8_t>> unpacked;
+    assert(unpack(envelope, unpacked) && unpacked == frames);
+}
+
+void test_corrupt() {
+    std::vector<std::vector<uint8_t>> frames = make_frames(10);
+    for (int compression = ENVELOPE_COMPRESSION_NONE; compression <= ENVELOPE_COMPRESSION_LZ4; compression++) {
+        std::vector<uint8_t> envelope;
+        pack_reissue_envelope(frames, static_cast<envelope_compression_t>(compression), envelope);
+        std::vector<std::vector<uint8_t>> unpacked;
+        // 截断
+        for (size_t length = 0; length < envelope.size(); length++) {
+            assert(!unpack_reissue_envelope(envelope.data(), length, unpacked));
+        }
+        // 报文区损坏由CRC32发现，压缩数据损坏后仍解出相同报文区（如重复数据的匹配距离变化）时可以接受
+        for (size_t i = 0; i < envelope.size(); i++) {
+            std::vector<uint8_t> corrupt = envelope;
+            corrupt[i] ^= 0x01;
+            if (unpack(corrupt, unpacked)) {
+                assert(compression == ENVELOPE_COMPRESSION_LZ4 && i >= kEnvelopeHeaderLength);
+                assert(unpacked == frames);
+                unpacked.clear();
+            }
+            assert(unpacked.empty());
+        }
+        // 未知的压缩方式与版本
+        std::vector<uint8_t> unknown = envelope;
+        unknown[3] = 0x02;
+        assert(!unpack(unknown, unpacked));
+        unknown = envelope;
+        unknown[2] = 0x02;
+        assert(!unpack(unknown, unpacked));
+    }
+}
+}
+
+int main() {
+    test_pack_unpack();
+    test_incompressible();
+    test_corrupt();
+    std::printf("rsms_reissue_envelope_test passed\n");
+    return 0;
+}
@@ -0,0 +1,194 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "rsms_reissue_ring.h"
+#include "rsms_reissue_store_test_util.h"
+
+namespace {
+using namespace store_test;
+
+// 存储文件大小，数据区只容纳一千多条记录，便于覆盖回绕与淘汰
+const size_t kCapacityBytes = 64 * 1024;
+// 模拟掉电时以页为单位丢失未落盘的写入
+const size_t kPageBytes = 4096;
+
+std::vector<char> read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::string &path, const std::vector<char> &content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+void test_append_and_peek() {
+    std::string dir_path = make_temp_dir();
+    std::string path = dir_path + "/reissue.ring";
+    RsmsReissueRing ring(path, kCapacityBytes, kSyncIntervalMs);
+    assert(ring.open());
+    assert(ring.size() == 0);
+    // 空记录与超过数据区四分之一的记录不写入
+    assert(!ring.append(reinterpret_cast<const uint8_t *>(""), 0));
+    std::vector<uint8_t> oversize(kCapacityBytes / 4);
+    assert(!ring.append(oversize.data(), oversize.size()));
+    append_records(ring, 1, 100);
+    assert(ring.head_sequence() == 1 && ring.size() == 100);
+    assert(check_records(ring, 0, 1000) == 100);
+    assert(check_records(ring, 50, 7) == 7);
+    assert(check_records(ring, 100, 7) == 1);
+    assert(check_records(ring, 101, 7) == 0);
+    ring.consume(41);
+    assert(ring.head_sequence() == 41 && ring.size() == 60);
+    assert(check_records(ring, 1, 1000) == 60);
+    ring.close();
+    remove_dir(dir_path);
+}
+
+void test_wraparound() {
+    std::string dir_path = make_temp_dir();
+    std::string path = dir_path + "/reissue.ring";
+    RsmsReissueRing ring(path, kCapacityBytes, kSyncIntervalMs);
+    assert(ring.open());
+    std::srand(1);
+    for (uint64_t sequence = 1; sequence <= 20000; sequence++) {
+        append_records(ring, sequence, sequence);
+        // 写满后淘汰最早的记录，首尾序号保持连续
+        assert(ring.head_sequence() + ring.size() == sequence + 1);
+        if (sequence % 997 == 0) {
+            ring.consume(ring.head_sequence() + 13);
+        }
+        if (sequence % 131 == 0) {
+            uint64_t head = ring.head_sequence();
+            uint64_t size = ring.size();
+            for (int i = 0; i < 5; i++) {
+                uint64_t target = head + (size > 0 ? std::rand() % size : 0);
+                assert(check_records(ring, target, 7) == std::min<uint64_t>(7, head + size - target));
+            }
+        }
+    }
+    assert(ring.head_sequence() > 1);
+    ring.close();
+    remove_dir(dir_path);
+}
+
+void test_reopen() {
+    std::string dir_path = make_temp_dir();
+    std::string path = dir_path + "/reissue.ring";
+    uint64_t head;
+    uint64_t size;
+    {
+        RsmsReissueRing ring(path, kCapacityBytes, kSyncIntervalMs);
+        assert(ring.open());
+        append_records(ring, 1, 5000);
+        ring.consume(ring.head_sequence() + 100);
+        head = ring.head_sequence();
+        size = ring.size();
+        ring.close();
+    }
+    RsmsReissueRing ring(path, kCapacityBytes, kSyncIntervalMs);
+    assert(ring.open());
+    assert(ring.head_sequence() == head && ring.size() == size);
+    assert(check_records(ring, 0, 100000) == size);
+    // 重新打开后继续追加，序号连续
+    append_records(ring, head + size, head + size + 99);
+    assert(ring.head_sequence() + ring.size() == head + size + 100);
+    assert(check_records(ring, head + size, 1000) == 100);
+    ring.close();
+    remove_dir(dir_path);
+}
+
+void test_process_crash() {
+    std::string dir_path = make_temp_dir();
+    std::string path = dir_path + "/reissue.ring";
+    // 进程崩溃时映射的页仍在页缓存中，追加的记录全部保留，读指针可能停留在最近一次落盘的位置
+    run_and_crash([&path]() {
+        return new RsmsReissueRing(path, kCapacityBytes, kSyncIntervalMs);
+    }, [](RsmsReissueStore &ring) {
+        append_records(ring, 1, 3000);
+        assert(ring.sync());
+        ring.consume(ring.head_sequence() + 50);
+        append_records(ring, 3001, 3500);
+    });
+    RsmsReissueRing ring(path, kCapacityBytes, kSyncIntervalMs);
+    assert(ring.open());
+    uint64_t head = ring.head_sequence();
+    uint64_t size = ring.size();
+    assert(head > 1 && head + size == 3501);
+    assert(check_records(ring, 0, 100000) == size);
+    append_records(ring, 3501, 3510);
+    assert(check_records(ring, 3501, 100) == 10);
+    ring.close();
+    remove_dir(dir_path);
+}
+
+void test_power_loss() {
+    std::string dir_path = make_temp_dir();
+    std::string path = dir_path + "/reissue.ring";
+    std::string synced_path = dir_path + "/synced.ring";
+    std::string state_path = dir_path + "/synced.state";
+    // 落盘后保存文件副本即为掉电后一定保留的内容，之后的追加有足够空闲空间，不触发元数据落盘
+    run_and_crash([&path]() {
+        return new RsmsReissueRing(path, kCapacityBytes, kSyncIntervalMs);
+    }, [&path, &synced_path, &state_path](RsmsReissueStore &ring) {
+        append_records(ring, 1, 3000);
+        ring.consume(2801);
+        assert(ring.sync());
+        write_file(synced_path, read_file(path));
+        std::string state = std::to_string(ring.head_sequence()) + " " + std::to_string(ring.size());
+        write_file(state_path, std::vector<char>(state.begin(), state.end()));
+        append_records(ring, 3001, 3100);
+        ring.consume(2901);
+    });
+    std::vector<char> synced = read_file(synced_path);
+    std::vector<char> crashed = read_file(path);
+    assert(synced.size() == kCapacityBytes && crashed.size() == kCapacityBytes);
+    std::vector<char> state = read_file(state_path);
+    uint64_t synced_head = 0;
+    uint64_t synced_size = 0;
+    assert(std::sscanf(std::string(state.begin(), state.end()).c_str(), "%llu %llu",
+                       reinterpret_cast<unsigned long long *>(&synced_head),
+                       reinterpret_cast<unsigned long long *>(&synced_size)) == 2);
+    assert(synced_head == 2801 && synced_size == 200);
+    // 未落盘的页全部丢失，或只有部分页写入，恢复的读指针为落盘时的位置，已落盘的记录完整保留
+    for (int mode = 0; mode < 3; mode++) {
+        std::vector<char> content = synced;
+        for (size_t page = 0; page < kCapacityBytes / kPageBytes && mode > 0; page++) {
+            if (page % 2 == static_cast<size_t>(mode - 1)) {
+                std::copy(crashed.begin() + page * kPageBytes, crashed.begin() + (page + 1) * kPageBytes,
+                          content.begin() + page * kPageBytes);
+            }
+        }
+        write_file(path, content);
+        RsmsReissueRing ring(path, kCapacityBytes, kSyncIntervalMs);
+        assert(ring.open());
+        assert(ring.head_sequence() == synced_head);
+        assert(ring.size() >= synced_size && ring.size() <= synced_size + 100);
+        assert(mode > 0 || ring.size() == synced_size);
+        assert(check_records(ring, 0, 100000) == ring.size());
+        ring.close();
+    }
+    remove_dir(dir_path);
+}
+}
+
+int main() {
+    test_append_and_peek();
+    test_wraparound();
+    test_reopen();
+    test_process_crash();
+    test_power_loss();
+    std::printf("rsms_reissue_ring_test passed\n");
+    return 0;
+}
@@ -0,0 +1,117 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+
+#ifndef RSMSAPP_RSMS_REISSUE_STORE_TEST_UTIL_H
+#define RSMSAPP_RSMS_REISSUE_STORE_TEST_UTIL_H
+
+#include <cassert>
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "rsms_reissue_store.h"
+
+// 补发数据存储测试的公共工具：记录内容由序号决定，读取时逐条校验序号与内容对应
+
+namespace store_test {
+// 测试期间不由后台线程落盘，只在显式sync或关闭时落盘，落盘时机由测试控制
+const int kSyncIntervalMs = 3600 * 1000;
+
+/**
+ * 生成记录，长度随序号变化
+ * @param sequence 序号
+ * @return 记录
+ */
+inline std::string make_record(uint64_t sequence) {
+    return "record-" + std::to_string(sequence) + "-" + std::string(sequence % 37 + 1, 'x');
+}
+
+/**
+ * 创建临时目录
+ * @return 目录路径
+ */
+inline std::string make_temp_dir() {
+    char path[] = "/tmp/rsms_store_test_XXXXXX";
+    assert(::mkdtemp(path) != nullptr);
+    return path;
+}
+
+/**
+ * 删除临时目录及其中的文件
+ * @param dir_path 目录路径
+ */
+inline void remove_dir(const std::string &dir_path) {
+    DIR *dir = ::opendir(dir_path.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    while (struct dirent *entry = ::readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name != "." && name != "..") {
+            ::unlink((dir_path + "/" + name).c_str());
+        }
+    }
+    ::closedir(dir);
+    ::rmdir(dir_path.c_str());
+}
+
+/**
+ * 追加序号范围内的记录
+ * @param store 存储
+ * @param first 起始序号
+ * @param last 结束序号（含）
+ */
+inline void append_records(RsmsReissueStore &store, uint64_t first, uint64_t last) {
+    for (uint64_t sequence = first; sequence <= last; sequence++) {
+        std::string record = make_record(sequence);
+        assert(store.append(reinterpret_cast<const uint8_t *>(record.data()), record.size()));
+    }
+}
+
+/**
+ * 从指定序号读取，校验从最早未消费记录之后开始且每条记录与其序号对应
+ * @param store 存储
+ * @param sequence 起始序号
+ * @param max_count 最多读取数量
+ * @return 读取数量
+ */
+inline size_t check_records(RsmsReissueStore &store, uint64_t sequence, size_t max_count) {
+    std::vector<std::vector<uint8_t>> frames;
+    uint64_t first = 0;
+    size_t count = store.peek(sequence, max_count, frames, first);
+    assert(count == frames.size());
+    assert(count == 0 || first == std::max(sequence, store.head_sequence()));
+    for (size_t i = 0; i < count; i++) {
+        assert(std::string(frames[i].begin(), frames[i].end()) == make_record(first + i));
+    }
+    return count;
+}
+
+/**
+ * 在子进程中打开存储并执行操作，之后不关闭存储直接退出，模拟进程崩溃
+ * 未落盘的数据仍在页缓存中，只能验证进程崩溃，掉电丢失未落盘数据需由测试另行模拟
+ * @param open_store 创建存储，子进程退出时不释放
+ * @param operation 对存储执行的操作
+ */
+template<typename Factory, typename Operation>
+void run_and_crash(Factory open_store, Operation operation) {
+    pid_t pid = ::fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+        RsmsReissueStore *store = open_store();
+        assert(store->open());
+        operation(*store);
+        ::_exit(0);
+    }
+    int status = 0;
+    assert(::waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+}
+
+#endif //RSMSAPP_RSMS_REISSUE_STORE_TEST_UTIL_H
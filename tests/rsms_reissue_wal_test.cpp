@@ -0,0 +1,149 @@
+//
+// Created by hwyz_leo on 2025/10/20.
+//
+// 发布构建同样启用断言
+#undef NDEBUG
+#include <cassert>
+#include <cstdio>
+#include <string>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "rsms_reissue_wal.h"
+#include "rsms_reissue_store_test_util.h"
+
+namespace {
+using namespace store_test;
+
+// 单段大小，每段只容纳几条记录，便于覆盖换段与删除段
+const size_t kSegmentBytes = 256;
+
+size_t count_segments(const std::string &dir_path) {
+    size_t count = 0;
+    DIR *dir = ::opendir(dir_path.c_str());
+    while (struct dirent *entry = ::readdir(dir)) {
+        std::string name = entry->d_name;
+        count += name.size() > 4 && name.compare(name.size() - 4, 4, ".seg") == 0 ? 1 : 0;
+    }
+    ::closedir(dir);
+    return count;
+}
+
+void test_reopen() {
+    std::string dir_path = make_temp_dir();
+    {
+        RsmsReissueWal wal(dir_path, kSegmentBytes, kSyncIntervalMs);
+        assert(wal.open());
+        append_records(wal, 1, 100);
+        wal.consume(31);
+        assert(wal.head_sequence() == 31);
+        wal.close();
+    }
+    RsmsReissueWal wal(dir_path, kSegmentBytes, kSyncIntervalMs);
+    assert(wal.open());
+    assert(wal.head_sequence() == 31 && wal.size() == 70);
+    assert(check_records(wal, 0, 1000) == 70);
+    // 重新打开后继续追加，序号连续
+    append_records(wal, 101, 120);
+    assert(check_records(wal, 0, 1000) == 90);
+    assert(check_records(wal, 100, 5) == 5);
+    // 全部消费后只保留写入段
+    wal.consume(121);
+    assert(wal.size() == 0);
+    assert(wal.sync());
+    assert(count_segments(dir_path) == 1);
+    wal.close();
+    remove_dir(dir_path);
+}
+
+void test_torn_tail() {
+    std::string dir_path = make_temp_dir();
+    {
+        RsmsReissueWal wal(dir_path, 1 << 20, kSyncIntervalMs);
+        assert(wal.open());
+        append_records(wal, 1, 10);
+        wal.close();
+    }
+    // 掉电时最后一条记录只写入一半
+    int fd = ::open((dir_path + "/0000000001.seg").c_str(), O_WRONLY | O_APPEND);
+    assert(fd >= 0);
+    const uint8_t torn[6] = {0x20, 0x00, 0x00, 0x00, 0x12, 0x34};
+    assert(::write(fd, torn, sizeof(torn)) == static_cast<ssize_t>(sizeof(torn)));
+    ::close(fd);
+    RsmsReissueWal wal(dir_path, 1 << 20, kSyncIntervalMs);
+    assert(wal.open());
+    assert(wal.size() == 10 && check_records(wal, 0, 1000) == 10);
+    append_records(wal, 11, 12);
+    wal.close();
+    RsmsReissueWal reopened(dir_path, 1 << 20, kSyncIntervalMs);
+    assert(reopened.open());
+    assert(reopened.size() == 12 && check_records(reopened, 0, 1000) == 12);
+    reopened.close();
+    remove_dir(dir_path);
+}
+
+void test_crash_after_consume() {
+    std::string dir_path = make_temp_dir();
+    // 消费后游标尚未落盘即崩溃，已消费的段不能先于游标删除
+    auto open_wal = [&dir_path]() {
+        return new RsmsReissueWal(dir_path, kSegmentBytes, kSyncIntervalMs);
+    };
+    run_and_crash(open_wal, [](RsmsReissueStore &wal) {
+        append_records(wal, 1, 100);
+        assert(wal.sync());
+        wal.consume(61);
+    });
+    {
+        RsmsReissueWal wal(dir_path, kSegmentBytes, kSyncIntervalMs);
+        assert(wal.open());
+        // 游标仍为落盘时的位置，重复补发但序号与数据一致
+        assert(wal.head_sequence() == 1 && wal.size() == 100);
+        assert(check_records(wal, 0, 1000) == 100);
+        wal.consume(61);
+        assert(wal.sync());
+    }
+    // 游标落盘后再崩溃，重新打开从新游标开始
+    run_and_crash(open_wal, [](RsmsReissueStore &wal) {
+        wal.consume(71);
+        assert(wal.sync());
+        append_records(wal, 101, 110);
+        assert(wal.sync());
+    });
+    RsmsReissueWal wal(dir_path, kSegmentBytes, kSyncIntervalMs);
+    assert(wal.open());
+    assert(wal.head_sequence() == 71 && wal.size() == 40);
+    assert(check_records(wal, 0, 1000) == 40);
+    wal.close();
+    remove_dir(dir_path);
+}
+
+void test_lost_cursor() {
+    std::string dir_path = make_temp_dir();
+    {
+        RsmsReissueWal wal(dir_path, kSegmentBytes, kSyncIntervalMs);
+        assert(wal.open());
+        append_records(wal, 1, 100);
+        wal.consume(61);
+        wal.close();
+    }
+    // 游标文件丢失时从最早的段开始，序号由段序号文件得出
+    assert(::unlink((dir_path + "/cursor").c_str()) == 0);
+    RsmsReissueWal wal(dir_path, kSegmentBytes, kSyncIntervalMs);
+    assert(wal.open());
+    assert(wal.head_sequence() > 1 && wal.head_sequence() <= 61);
+    assert(check_records(wal, 0, 1000) == wal.size());
+    wal.close();
+    remove_dir(dir_path);
+}
+}
+
+int main() {
+    test_reopen();
+    test_torn_tail();
+    test_crash_after_consume();
+    test_lost_cursor();
+    std::printf("rsms_reissue_wal_test passed\n");
+    return 0;
+}
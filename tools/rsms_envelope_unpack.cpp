@@ -0,0 +1,39 @@
+//
+// Created by hwyz_leo on 2025/10/19.
+//
+// 补发信封解包工具，供TSP侧对照实现或排查使用
+// 用法：rsms_envelope_unpack [信封文件]，未指定文件时从标准输入读取，每行输出一条国标报文的十六进制
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "rsms_reissue_envelope.h"
+
+int main(int argc, char *argv[]) {
+    std::vector<uint8_t> envelope;
+    if (argc > 1) {
+        std::ifstream file(argv[1], std::ios::binary);
+        if (!file) {
+            std::cerr << "无法打开文件" << argv[1] << std::endl;
+            return 2;
+        }
+        envelope.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    } else {
+        std::cin >> std::noskipws;
+        envelope.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+    }
+    std::vector<std::vector<uint8_t>> frames;
+    if (!unpack_reissue_envelope(envelope.data(), envelope.size(), frames)) {
+        std::cerr << "补发信封无效" << std::endl;
+        return 1;
+    }
+    for (const auto &frame: frames) {
+        for (uint8_t byte: frame) {
+            std::printf("%02X", byte);
+        }
+        std::printf("\n");
+    }
+    return 0;
+}